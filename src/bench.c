@@ -0,0 +1,178 @@
+/**
+ * @file bench.c
+ * @brief Medição de desempenho dos algoritmos sobre cargas sintéticas.
+ *
+ * Para cada tipo de carga (gerador.h) e cada n = 10, 100, ..., máximo, gera a
+ * carga com a semente informada e mede o tempo de cada algoritmo, sem contar
+ * a geração. Cada medição é a melhor de algumas repetições. A saída é CSV,
+ * para comparar as curvas de escala entre versões:
+ *
+ *   carga,algoritmo,n,repeticoes,ns_total,ns_por_processo,rss_pico_kb
+ *
+ * rss_pico_kb é o pico de memória residente do processo até aquela linha
+ * (0 onde getrusage não existe).
+ *
+ * Uso: escalonador-bench [-n maximo] [-s semente] [-r repeticoes] [-c carga] [-a algoritmo]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <limits.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>   // getrusage
+#endif
+#include "gerador.h"
+#include "simulador.h"
+
+// Limite de processos simulados por medição (n × repetições), para n grande não demorar demais
+#define PROCESSOS_POR_MEDICAO 10000000LL
+
+static void mostrar_uso(const char *programa) {
+    fprintf(stderr,
+            "Uso: %s [-n maximo] [-s semente] [-r repeticoes] [-c carga] [-a algoritmo]\n"
+            "  -n  maior quantidade de processos, percorrida em potências de 10 (padrão: 10000000)\n"
+            "  -s  semente dos geradores (padrão: 1)\n"
+            "  -r  repetições de cada medição; vale a melhor (padrão: 5)\n"
+            "  -c  uniforme, poisson, pareto, simultanea ou esparsa (padrão: todas)\n"
+            "  -a  fifo, sjf, rr, prioridade, mlfq, cfs ou srtf (padrão: todos)\n",
+            programa);
+}
+
+static long long agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Pico de memória residente do processo, em KB
+static long pico_rss_kb(void) {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) == 0) {
+#ifdef __APPLE__
+        return uso.ru_maxrss / 1024;    // macOS informa em bytes
+#else
+        return uso.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+// Verdadeiro se o relógio da simulação cabe em int: nenhum algoritmo termina
+// depois da última chegada somada a todas as execuções
+static int cabe_no_relogio(const Processo *processos, int n) {
+    long long fim = processos[n - 1].tempo_chegada;     // A carga sai em ordem de chegada
+    for (int i = 0; i < n; i++) {
+        fim += processos[i].tempo_execucao;
+    }
+    return fim <= INT_MAX;
+}
+
+int main(int argc, char *argv[]) {
+    long long maximo = 10000000;
+    unsigned long long semente = 1;
+    int repeticoes = 5;
+    const char *nome_carga = NULL;
+    const char *nome_alg = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            maximo = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            semente = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            repeticoes = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            nome_carga = argv[++i];
+        } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            nome_alg = argv[++i];
+        } else {
+            mostrar_uso(argv[0]);
+            return 2;
+        }
+    }
+    if (repeticoes < 1) {
+        repeticoes = 1;
+    }
+    if (maximo < 1) {
+        mostrar_uso(argv[0]);
+        return 2;
+    }
+    if (maximo > 1000000000) {
+        maximo = 1000000000;        // Maior potência de 10 em int; o limite de cada carga é conferido na geração
+    }
+
+    TipoCarga primeira_carga = CARGA_UNIFORME, ultima_carga = N_TIPOS_CARGA - 1;
+    if (nome_carga != NULL) {
+        if (!tipo_carga_por_nome(nome_carga, &primeira_carga)) {
+            fprintf(stderr, "Carga desconhecida: %s\n", nome_carga);
+            return 2;
+        }
+        ultima_carga = primeira_carga;
+    }
+    Algoritmo primeiro_alg = ALGORITMO_FIFO, ultimo_alg = N_ALGORITMOS - 1;
+    if (nome_alg != NULL) {
+        if (!algoritmo_por_nome(nome_alg, &primeiro_alg)) {
+            fprintf(stderr, "Algoritmo desconhecido: %s\n", nome_alg);
+            return 2;
+        }
+        ultimo_alg = primeiro_alg;
+    }
+
+    // A carga sai em ordem de chegada: a ordem é a identidade
+    Processo *processos = malloc(maximo * sizeof(Processo));
+    int *ordem = malloc(maximo * sizeof(int));
+    if (processos == NULL || ordem == NULL) {
+        fprintf(stderr, "Sem memória para %lld processos\n", maximo);
+        return 1;
+    }
+    for (int i = 0; i < maximo; i++) {
+        ordem[i] = i;
+    }
+
+    ResultadoSimulacao res;
+    resultado_inicializar(&res);
+
+    printf("carga,algoritmo,n,repeticoes,ns_total,ns_por_processo,rss_pico_kb\n");
+    for (int c = primeira_carga; c <= (int)ultima_carga; c++) {
+        for (long long n = 10; n <= maximo; n *= 10) {
+            if (n > maximo_processos_carga((TipoCarga)c) || !gerar_carga((TipoCarga)c, (int)n, semente, processos)
+                || !cabe_no_relogio(processos, (int)n)) {
+                fprintf(stderr, "%s: n = %lld passa do limite de tempo em int; parando nesta carga\n",
+                        nome_tipo_carga((TipoCarga)c), n);
+                break;
+            }
+
+            int rep = repeticoes;
+            if (n * rep > PROCESSOS_POR_MEDICAO) {
+                rep = (int)(PROCESSOS_POR_MEDICAO / n);
+                if (rep < 1) {
+                    rep = 1;
+                }
+            }
+
+            for (int a = primeiro_alg; a <= (int)ultimo_alg; a++) {
+                long long melhor = -1;
+                for (int r = 0; r < rep; r++) {
+                    long long inicio = agora_ns();
+                    simular_algoritmo((Algoritmo)a, processos, (int)n, ordem, QUANTUM_PADRAO, &res);
+                    long long duracao = agora_ns() - inicio;
+                    if (melhor < 0 || duracao < melhor) {
+                        melhor = duracao;
+                    }
+                }
+                printf("%s,%s,%lld,%d,%lld,%.2f,%ld\n", nome_tipo_carga((TipoCarga)c),
+                       nome_algoritmo((Algoritmo)a), n, rep, melhor, (double)melhor / n, pico_rss_kb());
+                fflush(stdout);
+            }
+        }
+    }
+
+    resultado_liberar(&res);
+    free(processos);
+    free(ordem);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file buffer.c
+ * @brief Implementação do buffer de texto crescente.
+ *
+ * Substitui os buffers de tamanho fixo e as chamadas a strcat na montagem
+ * dos resultados, evitando estouro de pilha em cargas com muitos processos.
+ */
+
+#include <stdarg.h>     // va_list para o anexo formatado
+#include <stdio.h>      // vsnprintf
+#include <stdlib.h>     // realloc, free
+#include <string.h>     // strlen, memcpy
+#include "buffer.h"
+
+// Capacidade inicial alocada no primeiro anexo
+#define CAPACIDADE_INICIAL 4096
+
+// Garante espaço para mais `extra` caracteres além do '\0'
+static void garantir_espaco(BufferSaida *buffer, size_t extra) {
+    size_t necessario = buffer->tamanho + extra + 1;
+    if (necessario <= buffer->capacidade) {
+        return;
+    }
+
+    // Dobra a capacidade até caber (crescimento geométrico = custo linear amortizado)
+    size_t nova = buffer->capacidade ? buffer->capacidade : CAPACIDADE_INICIAL;
+    while (nova < necessario) {
+        nova *= 2;
+    }
+
+    char *temp = realloc(buffer->dados, nova);
+    if (temp == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    buffer->dados = temp;
+    buffer->capacidade = nova;
+}
+
+void buffer_inicializar(BufferSaida *buffer) {
+    buffer->dados = NULL;
+    buffer->tamanho = 0;
+    buffer->capacidade = 0;
+    garantir_espaco(buffer, 0);
+    buffer->dados[0] = '\0';
+}
+
+void buffer_limpar(BufferSaida *buffer) {
+    buffer->tamanho = 0;
+    if (buffer->dados != NULL) {
+        buffer->dados[0] = '\0';
+    }
+}
+
+void buffer_anexar(BufferSaida *buffer, const char *texto) {
+    size_t n = strlen(texto);
+    garantir_espaco(buffer, n);
+    memcpy(buffer->dados + buffer->tamanho, texto, n + 1);
+    buffer->tamanho += n;
+}
+
+void buffer_anexar_formatado(BufferSaida *buffer, const char *formato, ...) {
+    va_list args;
+
+    // Primeira tentativa: escreve direto no espaço livre do buffer
+    garantir_espaco(buffer, 0);
+    size_t livre = buffer->capacidade - buffer->tamanho;
+    va_start(args, formato);
+    int n = vsnprintf(buffer->dados + buffer->tamanho, livre, formato, args);
+    va_end(args);
+    if (n < 0) {
+        buffer->dados[buffer->tamanho] = '\0';  // Erro de formatação: descarta o trecho
+        return;
+    }
+
+    // Não coube: cresce o buffer e formata novamente
+    if ((size_t)n >= livre) {
+        garantir_espaco(buffer, n);
+        va_start(args, formato);
+        vsnprintf(buffer->dados + buffer->tamanho, n + 1, formato, args);
+        va_end(args);
+    }
+    buffer->tamanho += n;
+}
+
+void buffer_liberar(BufferSaida *buffer) {
+    free(buffer->dados);
+    buffer->dados = NULL;
+    buffer->tamanho = 0;
+    buffer->capacidade = 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file buffer.h
+ * @brief Buffer de texto crescente usado para montar a saída das simulações.
+ *
+ * O buffer guarda o próprio tamanho, então anexar texto custa apenas o
+ * tamanho do trecho anexado (não é preciso percorrer o conteúdo como em strcat).
+ * A capacidade cresce geometricamente e é mantida entre execuções.
+ */
+
+#ifndef BUFFER_H              // Evita inclusão duplicada
+#define BUFFER_H
+
+#include <stddef.h>           // size_t
+
+// Buffer de texto terminado em '\0' com tamanho e capacidade conhecidos
+typedef struct {
+    char *dados;              // Conteúdo do buffer (sempre terminado em '\0')
+    size_t tamanho;           // Quantidade de caracteres escritos (sem o '\0')
+    size_t capacidade;        // Bytes alocados em `dados`
+} BufferSaida;
+
+// Inicializa um buffer vazio
+void buffer_inicializar(BufferSaida *buffer);
+
+// Esvazia o buffer mantendo a memória alocada para reutilização
+void buffer_limpar(BufferSaida *buffer);
+
+// Anexa uma string ao final do buffer
+void buffer_anexar(BufferSaida *buffer, const char *texto);
+
+// Anexa texto formatado (mesma sintaxe de printf) ao final do buffer
+void buffer_anexar_formatado(BufferSaida *buffer, const char *formato, ...);
+
+// Libera a memória do buffer
+void buffer_liberar(BufferSaida *buffer);
+
+#endif
@@ -0,0 +1,583 @@
+/**
+ * @file carga.c
+ * @brief Leitura (via mapeamento em memória) e escrita de cargas de trabalho.
+ *
+ * O arquivo inteiro é mapeado e percorrido uma única vez: os números são
+ * convertidos direto do mapeamento, sem cópia de linhas nem alocações por
+ * processo. Para arquivos com milhões de processos o custo fica dominado
+ * pela leitura do disco.
+ */
+
+#include <stdint.h>     // int32_t, uint32_t, uint64_t
+#include <stdio.h>      // FILE, fopen, fwrite
+#include <stdlib.h>     // malloc, realloc, free
+#include <string.h>     // memchr, memcmp, memcpy
+#include "carga.h"
+#include "buffer.h"     // Montagem do CSV em blocos
+
+#ifdef _WIN32
+#include <windows.h>    // CreateFileMapping / MapViewOfFile
+#else
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap, madvise
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#endif
+
+#define MAGICO_BINARIO "ESCB"        // Assinatura do formato binário
+#define VERSAO_BINARIO 1             // Versão atual do formato binário
+#define TAMANHO_CABECALHO 16         // Bytes do cabeçalho binário
+#define TAMANHO_REGISTRO 16          // Bytes por processo no formato binário
+#define BLOCO_ESCRITA (1 << 20)      // Tamanho dos blocos escritos no disco
+
+// ---------------------------------------------------------------------------
+// Mapeamento do arquivo em memória
+// ---------------------------------------------------------------------------
+
+// Arquivo mapeado somente para leitura
+typedef struct {
+    const char *dados;        // Início do conteúdo mapeado
+    size_t tamanho;           // Tamanho do arquivo em bytes
+#ifdef _WIN32
+    HANDLE arquivo;
+    HANDLE mapeamento;
+#else
+    int fd;
+#endif
+} ArquivoMapeado;
+
+// Mapeia o arquivo inteiro; retorna 0 em caso de erro
+static int mapear_arquivo(const char *caminho, ArquivoMapeado *mapa) {
+    mapa->dados = NULL;
+    mapa->tamanho = 0;
+#ifdef _WIN32
+    LARGE_INTEGER tamanho;
+    mapa->mapeamento = NULL;
+    mapa->arquivo = CreateFileA(caminho, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (mapa->arquivo == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+    if (!GetFileSizeEx(mapa->arquivo, &tamanho)) {
+        CloseHandle(mapa->arquivo);
+        return 0;
+    }
+    mapa->tamanho = (size_t)tamanho.QuadPart;
+    if (mapa->tamanho == 0) {
+        return 1;               // Arquivo vazio: não há o que mapear
+    }
+    mapa->mapeamento = CreateFileMappingA(mapa->arquivo, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapa->mapeamento == NULL) {
+        CloseHandle(mapa->arquivo);
+        return 0;
+    }
+    mapa->dados = MapViewOfFile(mapa->mapeamento, FILE_MAP_READ, 0, 0, 0);
+    if (mapa->dados == NULL) {
+        CloseHandle(mapa->mapeamento);
+        CloseHandle(mapa->arquivo);
+        return 0;
+    }
+#else
+    struct stat info;
+    mapa->fd = open(caminho, O_RDONLY);
+    if (mapa->fd < 0) {
+        return 0;
+    }
+    if (fstat(mapa->fd, &info) != 0) {
+        close(mapa->fd);
+        return 0;
+    }
+    mapa->tamanho = (size_t)info.st_size;
+    if (mapa->tamanho == 0) {
+        return 1;               // Arquivo vazio: mmap não aceita tamanho zero
+    }
+    void *p = mmap(NULL, mapa->tamanho, PROT_READ, MAP_PRIVATE, mapa->fd, 0);
+    if (p == MAP_FAILED) {
+        close(mapa->fd);
+        return 0;
+    }
+    madvise(p, mapa->tamanho, MADV_SEQUENTIAL);   // Leitura será sequencial
+    mapa->dados = p;
+#endif
+    return 1;
+}
+
+// Desfaz o mapeamento e fecha o arquivo
+static void desmapear_arquivo(ArquivoMapeado *mapa) {
+#ifdef _WIN32
+    if (mapa->dados != NULL) UnmapViewOfFile(mapa->dados);
+    if (mapa->mapeamento != NULL) CloseHandle(mapa->mapeamento);
+    CloseHandle(mapa->arquivo);
+#else
+    if (mapa->dados != NULL) munmap((void *)mapa->dados, mapa->tamanho);
+    close(mapa->fd);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Leitura
+// ---------------------------------------------------------------------------
+
+// Verdadeiro para os separadores de campo aceitos no formato texto
+static int eh_separador(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+// Lê um inteiro com sinal em [*p, fim); retorna 0 se não houver número válido
+static int ler_inteiro(const char **p, const char *fim, int *valor) {
+    const char *c = *p;
+    int negativo = 0;
+    long long acumulado = 0;
+
+    if (c < fim && (*c == '-' || *c == '+')) {
+        negativo = (*c == '-');
+        c++;
+    }
+    if (c >= fim || *c < '0' || *c > '9') {
+        return 0;
+    }
+    while (c < fim && *c >= '0' && *c <= '9') {
+        acumulado = acumulado * 10 + (*c - '0');
+        if (acumulado > 2147483648LL) {
+            return 0;           // Não cabe em int
+        }
+        c++;
+    }
+    if (negativo) acumulado = -acumulado;
+    if (acumulado > 2147483647LL) {
+        return 0;
+    }
+
+    *valor = (int)acumulado;
+    *p = c;
+    return 1;
+}
+
+// Interpreta a linha que começa em *p e avança *p até o início da próxima
+// - cabecalho: 1 se uma linha não numérica pode ser o cabeçalho (antes do primeiro processo)
+// Retorna a quantidade de campos lidos em `campos` (0 = linha vazia, comentário ou
+// cabeçalho, 3 ou 4 = processo) ou -1 se a linha for inválida
+static int ler_linha(const char **p, const char *fim, int cabecalho, int campos[4]) {
+    const char *c = *p;
+    int n_campos = 0;
+
+    while (c < fim && eh_separador(*c)) c++;
+
+    // Linha de cabeçalho (ex.: "pid,chegada,execucao,prioridade") antes do primeiro processo
+    if (cabecalho && c < fim && ((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z'))) {
+        const char *q = memchr(c, '\n', fim - c);
+        *p = q ? q + 1 : fim;
+        return 0;
+    }
+
+    // Lê até 4 inteiros da linha
+    while (c < fim && *c != '\n' && *c != '#') {
+        if (n_campos == 4 || !ler_inteiro(&c, fim, &campos[n_campos])) {
+            return -1;
+        }
+        n_campos++;
+
+        // Depois de um número só pode vir separador, comentário ou fim de linha
+        if (c < fim && !eh_separador(*c) && *c != '\n' && *c != '#') {
+            return -1;
+        }
+        while (c < fim && eh_separador(*c)) c++;
+    }
+
+    // Pula o restante da linha (comentário) e a quebra de linha
+    if (c < fim && *c != '\n') {
+        const char *q = memchr(c, '\n', fim - c);
+        c = q ? q : fim;
+    }
+    if (c < fim) c++;
+    *p = c;
+
+    if (n_campos > 0 && n_campos < 3) {
+        return -1;
+    }
+    return n_campos;
+}
+
+// Verdadeiro se o processo pode ser simulado: chegada e execução não negativas
+static int processo_valido(const Processo *p) {
+    return p->tempo_chegada >= 0 && p->tempo_execucao >= 0;
+}
+
+// Preenche o processo a partir dos campos de uma linha; sem PID explícito,
+// numera os processos em sequência como a interface. Retorna 0 se os tempos forem inválidos
+static int processo_da_linha(const int campos[4], int n_campos, int posicao, Processo *p) {
+    int base = (n_campos == 4) ? 1 : 0;
+    p->pid = (n_campos == 4) ? campos[0] : posicao + 1;
+    p->tempo_chegada = campos[base];
+    p->tempo_execucao = campos[base + 1];
+    p->prioridade = campos[base + 2];
+    return processo_valido(p);
+}
+
+// Interpreta o formato texto; o vetor é alocado uma vez, pelo número de linhas
+static StatusCarga ler_texto(const char *dados, size_t tamanho, Processo **lista, int *n, int *linha_erro) {
+    const char *p = dados;
+    const char *fim = dados + tamanho;
+    size_t linhas = 1;
+    int numero_linha = 0;
+    int total = 0;
+
+    // Conta as quebras de linha para saber o máximo de processos possível
+    for (const char *q = dados; q < fim && (q = memchr(q, '\n', fim - q)) != NULL; q++) {
+        linhas++;
+    }
+    if (linhas > 2147483647u) {
+        return CARGA_ERRO_FORMATO;
+    }
+
+    Processo *vetor = malloc(linhas * sizeof(Processo));
+    if (vetor == NULL) {
+        return CARGA_ERRO_MEMORIA;
+    }
+
+    while (p < fim) {
+        int campos[4];
+        numero_linha++;
+        int n_campos = ler_linha(&p, fim, total == 0, campos);
+        if (n_campos == 0) continue;   // Linha vazia, comentário ou cabeçalho
+        if (n_campos < 0 || !processo_da_linha(campos, n_campos, total, &vetor[total])) {
+            free(vetor);
+            if (linha_erro) *linha_erro = numero_linha;
+            return CARGA_ERRO_FORMATO;
+        }
+        total++;
+    }
+
+    // Devolve a sobra quando havia muitas linhas sem processo
+    if ((size_t)total < linhas && total > 0) {
+        Processo *temp = realloc(vetor, total * sizeof(Processo));
+        if (temp != NULL) vetor = temp;
+    }
+
+    *lista = vetor;
+    *n = total;
+    return CARGA_OK;
+}
+
+// Lê um inteiro de 32 bits little-endian
+static int32_t ler_le32(const unsigned char *b) {
+    return (int32_t)((uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24));
+}
+
+// Escreve um inteiro de 32 bits little-endian
+static void escrever_le32(unsigned char *b, uint32_t v) {
+    b[0] = (unsigned char)v;
+    b[1] = (unsigned char)(v >> 8);
+    b[2] = (unsigned char)(v >> 16);
+    b[3] = (unsigned char)(v >> 24);
+}
+
+// Verdadeiro se a máquina é little-endian e Processo tem o mesmo layout do registro
+static int layout_compativel(void) {
+    const uint16_t um = 1;
+    return *(const unsigned char *)&um == 1 && sizeof(Processo) == TAMANHO_REGISTRO;
+}
+
+// Interpreta o formato binário
+static StatusCarga ler_binario(const char *dados, size_t tamanho, Processo **lista, int *n, int *linha_erro) {
+    const unsigned char *b = (const unsigned char *)dados;
+
+    if (tamanho < TAMANHO_CABECALHO || ler_le32(b + 4) != VERSAO_BINARIO) {
+        return CARGA_ERRO_FORMATO;
+    }
+    uint64_t total = (uint64_t)(uint32_t)ler_le32(b + 8) | ((uint64_t)(uint32_t)ler_le32(b + 12) << 32);
+    if (total > 2147483647u || total > (tamanho - TAMANHO_CABECALHO) / TAMANHO_REGISTRO) {
+        return CARGA_ERRO_FORMATO;
+    }
+
+    Processo *vetor = malloc((total > 0 ? total : 1) * sizeof(Processo));
+    if (vetor == NULL) {
+        return CARGA_ERRO_MEMORIA;
+    }
+
+    b += TAMANHO_CABECALHO;
+    if (layout_compativel()) {
+        memcpy(vetor, b, total * TAMANHO_REGISTRO);    // Mesmo layout: cópia direta
+    } else {
+        for (uint64_t i = 0; i < total; i++, b += TAMANHO_REGISTRO) {
+            vetor[i].pid = ler_le32(b);
+            vetor[i].tempo_chegada = ler_le32(b + 4);
+            vetor[i].tempo_execucao = ler_le32(b + 8);
+            vetor[i].prioridade = ler_le32(b + 12);
+        }
+    }
+    for (uint64_t i = 0; i < total; i++) {
+        if (!processo_valido(&vetor[i])) {
+            free(vetor);
+            if (linha_erro) *linha_erro = -(int)(i + 1);
+            return CARGA_ERRO_FORMATO;
+        }
+    }
+
+    *lista = vetor;
+    *n = (int)total;
+    return CARGA_OK;
+}
+
+StatusCarga carregar_carga_memoria(const char *dados, size_t tamanho, Processo **lista, int *n, int *linha_erro) {
+    if (tamanho >= 4 && memcmp(dados, MAGICO_BINARIO, 4) == 0) {
+        return ler_binario(dados, tamanho, lista, n, linha_erro);
+    }
+    return ler_texto(dados, tamanho, lista, n, linha_erro);
+}
+
+StatusCarga carregar_carga(const char *caminho, Processo **lista, int *n, int *linha_erro) {
+    ArquivoMapeado mapa;
+    if (!mapear_arquivo(caminho, &mapa)) {
+        return CARGA_ERRO_ARQUIVO;
+    }
+
+    StatusCarga status = carregar_carga_memoria(mapa.dados ? mapa.dados : "", mapa.tamanho, lista, n, linha_erro);
+    desmapear_arquivo(&mapa);
+    return status;
+}
+
+// ---------------------------------------------------------------------------
+// Leitura em fluxo
+// ---------------------------------------------------------------------------
+
+// Garante pelo menos `minimo` bytes a interpretar no bloco (menos só no fim do
+// arquivo), movendo o que sobrou para o início e crescendo o bloco se preciso
+static int completar_bloco_carga(LeitorCarga *l, size_t minimo) {
+    if (l->fim - l->inicio >= minimo || l->fim_arquivo) {
+        return 1;
+    }
+    memmove(l->bloco, l->bloco + l->inicio, l->fim - l->inicio);
+    l->fim -= l->inicio;
+    l->inicio = 0;
+    if (minimo > l->capacidade) {
+        size_t nova = l->capacidade;
+        while (nova < minimo) nova *= 2;
+        char *temp = realloc(l->bloco, nova);
+        if (temp == NULL) {
+            return 0;
+        }
+        l->bloco = temp;
+        l->capacidade = nova;
+    }
+    while (!l->fim_arquivo && l->fim < minimo) {
+        size_t lido = fread(l->bloco + l->fim, 1, l->capacidade - l->fim, l->arquivo);
+        l->fim += lido;
+        if (lido == 0) {
+            l->fim_arquivo = 1;
+        }
+    }
+    return 1;
+}
+
+StatusCarga carga_abrir_fluxo(LeitorCarga *leitor, const char *caminho) {
+    leitor->fechar = strcmp(caminho, "-") != 0;
+    leitor->arquivo = leitor->fechar ? fopen(caminho, "rb") : stdin;
+    if (leitor->arquivo == NULL) {
+        return CARGA_ERRO_ARQUIVO;
+    }
+    leitor->capacidade = BLOCO_ESCRITA;
+    leitor->bloco = malloc(leitor->capacidade);
+    if (leitor->bloco == NULL) {
+        if (leitor->fechar) fclose(leitor->arquivo);
+        return CARGA_ERRO_MEMORIA;
+    }
+    leitor->inicio = 0;
+    leitor->fim = 0;
+    leitor->fim_arquivo = 0;
+    leitor->lidos = 0;
+    leitor->linha = 0;
+    leitor->status = CARGA_OK;
+
+    // O cabeçalho binário decide o formato, como em carregar_carga_memoria
+    completar_bloco_carga(leitor, TAMANHO_CABECALHO);
+    leitor->binario = leitor->fim >= 4 && memcmp(leitor->bloco, MAGICO_BINARIO, 4) == 0;
+    if (leitor->binario) {
+        const unsigned char *b = (const unsigned char *)leitor->bloco;
+        if (leitor->fim < TAMANHO_CABECALHO || ler_le32(b + 4) != VERSAO_BINARIO) {
+            carga_fechar_fluxo(leitor);
+            return CARGA_ERRO_FORMATO;
+        }
+        leitor->restantes = (long long)((uint64_t)(uint32_t)ler_le32(b + 8) |
+                                        ((uint64_t)(uint32_t)ler_le32(b + 12) << 32));
+        if (leitor->restantes < 0 || leitor->restantes > 2147483647) {
+            carga_fechar_fluxo(leitor);
+            return CARGA_ERRO_FORMATO;
+        }
+        leitor->inicio = TAMANHO_CABECALHO;
+    }
+    return CARGA_OK;
+}
+
+// Próximo processo do formato texto; retorna 1, 0 (fim) ou -1 (erro)
+static int ler_proximo_texto(LeitorCarga *l, Processo *p) {
+    for (;;) {
+        // Garante uma linha inteira no bloco (ou o resto do arquivo, na última)
+        const char *quebra;
+        size_t pedido = l->capacidade;
+        while ((quebra = memchr(l->bloco + l->inicio, '\n', l->fim - l->inicio)) == NULL && !l->fim_arquivo) {
+            if (!completar_bloco_carga(l, pedido)) {
+                l->status = CARGA_ERRO_MEMORIA;
+                return -1;
+            }
+            pedido = l->capacidade + 1;     // Linha maior que o bloco: dobra na próxima volta
+        }
+        if (l->inicio == l->fim) {
+            return 0;
+        }
+
+        const char *c = l->bloco + l->inicio;
+        const char *fim_linha = quebra ? quebra + 1 : l->bloco + l->fim;
+        int campos[4];
+        l->linha++;
+        int n_campos = ler_linha(&c, fim_linha, l->lidos == 0, campos);
+        l->inicio = (size_t)(c - l->bloco);
+        if (n_campos < 0 || (n_campos > 0 && !processo_da_linha(campos, n_campos, l->lidos, p))) {
+            l->status = CARGA_ERRO_FORMATO;
+            return -1;
+        }
+        if (n_campos > 0) {
+            return 1;
+        }
+    }
+}
+
+// Próximo processo do formato binário; retorna 1, 0 (fim) ou -1 (erro)
+static int ler_proximo_binario(LeitorCarga *l, Processo *p) {
+    if (l->restantes == 0) {
+        return 0;
+    }
+    completar_bloco_carga(l, TAMANHO_REGISTRO);
+    if (l->fim - l->inicio < TAMANHO_REGISTRO) {
+        l->status = CARGA_ERRO_FORMATO;     // Menos registros que o cabeçalho anuncia
+        return -1;
+    }
+    const unsigned char *b = (const unsigned char *)l->bloco + l->inicio;
+    p->pid = ler_le32(b);
+    p->tempo_chegada = ler_le32(b + 4);
+    p->tempo_execucao = ler_le32(b + 8);
+    p->prioridade = ler_le32(b + 12);
+    if (!processo_valido(p)) {
+        l->status = CARGA_ERRO_FORMATO;     // Registro l->lidos + 1
+        return -1;
+    }
+    l->inicio += TAMANHO_REGISTRO;
+    l->restantes--;
+    return 1;
+}
+
+int carga_ler_proximo(LeitorCarga *leitor, Processo *p) {
+    if (leitor->status != CARGA_OK) {
+        return -1;
+    }
+    int lido = leitor->binario ? ler_proximo_binario(leitor, p) : ler_proximo_texto(leitor, p);
+    if (lido <= 0) {
+        return lido;
+    }
+
+    // A simulação em fluxo não pode voltar no tempo: exige a mesma ordem de ordenar_por_chegada
+    const Processo *a = &leitor->anterior;
+    if (leitor->lidos > 0 && (p->tempo_chegada < a->tempo_chegada ||
+                              (p->tempo_chegada == a->tempo_chegada && p->pid <= a->pid))) {
+        leitor->status = CARGA_ERRO_ORDEM;
+        return -1;
+    }
+    leitor->anterior = *p;
+    leitor->lidos++;
+    return 1;
+}
+
+void carga_fechar_fluxo(LeitorCarga *leitor) {
+    if (leitor->fechar) {
+        fclose(leitor->arquivo);
+    }
+    free(leitor->bloco);
+    leitor->arquivo = NULL;
+    leitor->bloco = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Escrita
+// ---------------------------------------------------------------------------
+
+StatusCarga salvar_carga_csv(const char *caminho, const Processo *lista, int n) {
+    FILE *arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL) {
+        return CARGA_ERRO_ARQUIVO;
+    }
+
+    BufferSaida bloco;
+    int ok = 1;
+    buffer_inicializar(&bloco);
+    buffer_anexar(&bloco, "pid,chegada,execucao,prioridade\n");
+
+    // Monta o texto em blocos de ~1 MB e grava cada bloco de uma vez
+    for (int i = 0; i < n && ok; i++) {
+        buffer_anexar_formatado(&bloco, "%d,%d,%d,%d\n", lista[i].pid, lista[i].tempo_chegada,
+                                lista[i].tempo_execucao, lista[i].prioridade);
+        if (bloco.tamanho >= BLOCO_ESCRITA) {
+            ok = fwrite(bloco.dados, 1, bloco.tamanho, arquivo) == bloco.tamanho;
+            buffer_limpar(&bloco);
+        }
+    }
+    if (ok && bloco.tamanho > 0) {
+        ok = fwrite(bloco.dados, 1, bloco.tamanho, arquivo) == bloco.tamanho;
+    }
+
+    buffer_liberar(&bloco);
+    if (fclose(arquivo) != 0) ok = 0;
+    return ok ? CARGA_OK : CARGA_ERRO_ARQUIVO;
+}
+
+StatusCarga salvar_carga_binaria(const char *caminho, const Processo *lista, int n) {
+    FILE *arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL) {
+        return CARGA_ERRO_ARQUIVO;
+    }
+
+    unsigned char cabecalho[TAMANHO_CABECALHO];
+    int ok;
+    memcpy(cabecalho, MAGICO_BINARIO, 4);
+    escrever_le32(cabecalho + 4, VERSAO_BINARIO);
+    escrever_le32(cabecalho + 8, (uint32_t)n);
+    escrever_le32(cabecalho + 12, 0);
+    ok = fwrite(cabecalho, 1, TAMANHO_CABECALHO, arquivo) == TAMANHO_CABECALHO;
+
+    if (layout_compativel()) {
+        // Mesmo layout do registro: grava o vetor direto
+        ok = ok && fwrite(lista, TAMANHO_REGISTRO, n, arquivo) == (size_t)n;
+    } else {
+        unsigned char *bloco = malloc(BLOCO_ESCRITA);
+        int por_bloco = BLOCO_ESCRITA / TAMANHO_REGISTRO;
+        if (bloco == NULL) {
+            fclose(arquivo);
+            return CARGA_ERRO_MEMORIA;
+        }
+        for (int i = 0; i < n && ok; i += por_bloco) {
+            int qtd = (n - i < por_bloco) ? n - i : por_bloco;
+            for (int k = 0; k < qtd; k++) {
+                unsigned char *b = bloco + (size_t)k * TAMANHO_REGISTRO;
+                escrever_le32(b, (uint32_t)lista[i + k].pid);
+                escrever_le32(b + 4, (uint32_t)lista[i + k].tempo_chegada);
+                escrever_le32(b + 8, (uint32_t)lista[i + k].tempo_execucao);
+                escrever_le32(b + 12, (uint32_t)lista[i + k].prioridade);
+            }
+            ok = fwrite(bloco, TAMANHO_REGISTRO, qtd, arquivo) == (size_t)qtd;
+        }
+        free(bloco);
+    }
+
+    if (fclose(arquivo) != 0) ok = 0;
+    return ok ? CARGA_OK : CARGA_ERRO_ARQUIVO;
+}
+
+const char* descrever_status_carga(StatusCarga status) {
+    switch (status) {
+        case CARGA_OK:            return "ok";
+        case CARGA_ERRO_ARQUIVO:  return "erro ao acessar o arquivo";
+        case CARGA_ERRO_FORMATO:  return "formato inválido";
+        case CARGA_ERRO_MEMORIA:  return "memória insuficiente";
+        case CARGA_ERRO_ORDEM:    return "processos fora da ordem de chegada";
+    }
+    return "erro desconhecido";
+}
@@ -0,0 +1,84 @@
+/**
+ * @file carga.h
+ * @brief Leitura e escrita de cargas de trabalho (listas de processos) em arquivo.
+ *
+ * São suportados dois formatos:
+ *  - Texto/CSV: uma linha por processo com "chegada execucao prioridade" ou
+ *    "pid chegada execucao prioridade", separados por espaço, tab, vírgula ou
+ *    ponto e vírgula. Linhas vazias, comentários ('#') e uma linha de cabeçalho
+ *    não numérica no início são ignorados.
+ *  - Binário: cabeçalho de 16 bytes ("ESCB", versão, quantidade) seguido de
+ *    registros de 4 inteiros de 32 bits little-endian (pid, chegada, execução,
+ *    prioridade).
+ *
+ * Nos dois formatos, chegada ou execução negativa é erro de formato.
+ *
+ * O arquivo é mapeado em memória e interpretado sem alocações por linha:
+ * a lista de processos é alocada uma única vez. Para cargas maiores que a
+ * memória, a leitura em fluxo entrega um processo por vez, lendo o arquivo
+ * em blocos, e exige que ele esteja em ordem de chegada.
+ */
+
+#ifndef CARGA_H               // Evita inclusão duplicada
+#define CARGA_H
+
+#include <stddef.h>           // size_t
+#include <stdio.h>            // FILE
+#include "processos.h"        // Definição da struct Processo
+
+// Resultado das operações de carga
+typedef enum {
+    CARGA_OK = 0,             // Operação concluída
+    CARGA_ERRO_ARQUIVO,       // Não foi possível abrir, mapear ou escrever o arquivo
+    CARGA_ERRO_FORMATO,       // Conteúdo inválido (ver linha_erro)
+    CARGA_ERRO_MEMORIA,       // Falha de alocação
+    CARGA_ERRO_ORDEM          // Leitura em fluxo: processo antes do anterior em (chegada, PID)
+} StatusCarga;
+
+// Leitura de uma carga em fluxo
+typedef struct {
+    FILE *arquivo;
+    int fechar;               // 1 = o arquivo foi aberto aqui (0 = entrada padrão)
+    char *bloco;              // Bytes lidos e ainda não interpretados
+    size_t capacidade;        // Bytes alocados em `bloco` (cresce se uma linha não couber)
+    size_t inicio;            // Próximo byte a interpretar
+    size_t fim;               // Fim dos bytes válidos em `bloco`
+    int fim_arquivo;          // 1 quando não há mais nada a ler do arquivo
+    int binario;              // 1 = formato binário
+    long long restantes;      // Binário: registros ainda não lidos
+    int lidos;                // Processos já entregues (binário: o registro com erro é lidos + 1)
+    int linha;                // Texto: última linha interpretada (para mensagens de erro)
+    Processo anterior;        // Último processo entregue
+    StatusCarga status;       // Motivo do erro, quando carga_ler_proximo retorna -1
+} LeitorCarga;
+
+// Carrega a carga de trabalho do arquivo (texto ou binário, detectado pelo conteúdo)
+// - lista/n: recebem o vetor alocado (liberar com free) e a quantidade de processos
+// - linha_erro: se não for NULL, recebe a linha do erro de formato (texto) ou,
+//   com sinal negativo, o número do registro inválido (binário, a partir de 1)
+StatusCarga carregar_carga(const char *caminho, Processo **lista, int *n, int *linha_erro);
+
+// Igual a carregar_carga, mas interpreta um conteúdo já em memória
+StatusCarga carregar_carga_memoria(const char *dados, size_t tamanho, Processo **lista, int *n, int *linha_erro);
+
+// Abre a carga para leitura em fluxo ("-" = entrada padrão), no formato detectado pelo conteúdo
+StatusCarga carga_abrir_fluxo(LeitorCarga *leitor, const char *caminho);
+
+// Lê o próximo processo; retorna 1 se leu, 0 no fim da carga e -1 em erro
+// (o motivo fica em leitor->status e, no formato texto, a linha em leitor->linha)
+// Os processos devem vir em ordem crescente de (chegada, PID)
+int carga_ler_proximo(LeitorCarga *leitor, Processo *p);
+
+// Fecha o arquivo e libera o leitor
+void carga_fechar_fluxo(LeitorCarga *leitor);
+
+// Salva a lista em formato texto CSV (com linha de cabeçalho)
+StatusCarga salvar_carga_csv(const char *caminho, const Processo *lista, int n);
+
+// Salva a lista no formato binário
+StatusCarga salvar_carga_binaria(const char *caminho, const Processo *lista, int n);
+
+// Retorna uma descrição legível do status
+const char* descrever_status_carga(StatusCarga status);
+
+#endif
@@ -0,0 +1,713 @@
+/**
+ * @file cli.c
+ * @brief Simulador em linha de comando, sem interface gráfica.
+ *
+ * Lê uma carga de trabalho de um arquivo, executa um ou todos os algoritmos
+ * e escreve o resultado em texto ou CSV na saída padrão. Usa apenas a
+ * biblioteca libescalonador, então roda em máquinas sem display/GTK.
+ *
+ * Uso: escalonador-cli [-a algoritmo|todos] [-q quantum] [-c cpus] [-r] [-m custo]
+ *                       [-Q q0,q1,...] [-b periodo] [-L latencia] [-G granularidade]
+ *                       [-f texto|csv|resumo] [-j instrumentacao.json] [-w saida] [-x rastro] arquivo
+ *        escalonador-cli -d rastro
+ *        escalonador-cli -e [-a ...] [-f csv|resumo] [-x rastro] [-g carga [-n processos] [-s semente] | arquivo]
+ *        escalonador-cli [-a ...] [-p q1,q2,...] [-k amostras] [-t threads]
+ *                       [-g carga [-n processos] [-s semente] | arquivo]
+ *
+ * O arquivo pode estar no formato texto/CSV ou binário (ver carga.h).
+ * Use "-" para ler da entrada padrão. Com -w, a carga lida é gravada em
+ * `saida` (binário se terminar em ".bin", CSV caso contrário) e nenhuma
+ * simulação é executada. Com -j, cada execução acrescenta uma linha JSON com
+ * os contadores da instrumentação (compilada com make INSTRUMENTACAO=1).
+ * Com -x, os intervalos de todas as execuções são gravados durante a simulação
+ * em um rastro binário compacto (ver rastro.h), que -d despeja em texto.
+ *
+ * Com -p, -k, -t ou -g, o programa entra no modo varredura: cada algoritmo
+ * (RR e MLFQ uma vez por quantum de -p) roda sobre -k amostras em paralelo, e
+ * a saída é uma linha CSV por combinação com a média e o intervalo de confiança
+ * de 95% de cada métrica. Com -g, cada amostra é uma carga sintética gerada com
+ * a semente -s + amostra, no lugar do arquivo. A varredura não aceita -j nem -x.
+ *
+ * Com -e, a simulação é feita em fluxo (ver simular_em_fluxo), em uma CPU: a
+ * carga é lida aos poucos (do arquivo, que deve estar em ordem de chegada, ou
+ * gerada com -g) e só os processos residentes ficam na memória. Com -f csv,
+ * cada processo é escrito quando termina; nos demais formatos, só as
+ * estatísticas agregadas. Com "todos", o arquivo é lido uma vez por algoritmo.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "processos.h"
+#include "simulador.h"
+#include "relatorio.h"
+#include "carga.h"
+#include "multicpu.h"
+#include "gerador.h"
+#include "varredura.h"
+#include "paralelo.h"
+#include "rastro.h"
+
+// Quantidade máxima de quanta na lista de -p
+#define MAX_QUANTA_VARREDURA 64
+
+// Processos por carga gerada com -g, se -n não for informado
+#define PROCESSOS_GERADOS_PADRAO 10000
+
+// Bytes de CSV acumulados antes de cada escrita no modo fluxo
+#define BLOCO_SAIDA_FLUXO (1 << 20)
+
+// Amostras por combinação no modo varredura, se -k não for informado
+#define AMOSTRAS_PADRAO_GERADAS 10      // Com -g: uma carga por amostra
+#define AMOSTRAS_PADRAO_ARQUIVO 1       // Com arquivo: só o sorteio de CPUs muda entre amostras
+
+// Formatos de saída suportados
+typedef enum {
+    SAIDA_TEXTO,
+    SAIDA_CSV,
+    SAIDA_RESUMO                        // Apenas as estatísticas agregadas
+} FormatoSaida;
+
+// Mostra a forma de uso do programa
+static void mostrar_uso(const char *programa) {
+    ConfigCFS padrao_cfs;
+    cfs_config_padrao(&padrao_cfs);
+    fprintf(stderr,
+            "Uso: %s [-a algoritmo|todos] [-q quantum] [-c cpus] [-r] [-m custo]\n"
+            "       [-Q q0,q1,...] [-b periodo] [-L latencia] [-G granularidade]\n"
+            "       [-f texto|csv|resumo] [-j json] [-w saida] [-x rastro] arquivo\n"
+            "   ou: %s -d rastro\n"
+            "   ou: %s -e [-a ...] [-f csv|resumo] [-x rastro] [-g carga [-n processos] [-s semente] | arquivo]\n"
+            "   ou: %s [-a ...] [-p q1,q2,...] [-k amostras] [-t threads]\n"
+            "       [-g carga [-n processos] [-s semente] | arquivo]\n"
+            "  -a  fifo, sjf, rr, prioridade, mlfq, cfs, srtf ou todos (padrão: todos)\n"
+            "  -q  quantum do Round-Robin (padrão: %d)\n"
+            "  -c  quantidade de CPUs, cada uma com sua fila de prontos (padrão: 1)\n"
+            "  -r  ativa o roubo de trabalho entre CPUs\n"
+            "  -m  custo de migração de um processo entre CPUs (padrão: 0)\n"
+            "  -Q  quanta dos níveis do MLFQ (padrão: q, 2q, 4q)\n"
+            "  -b  período do boost do MLFQ, 0 = sem boost (padrão: 50q)\n"
+            "  -L  latência alvo do CFS (padrão: %d)\n"
+            "  -G  granularidade mínima do CFS (padrão: %d)\n"
+            "  -f  formato da saída: texto, csv ou resumo (só as estatísticas) (padrão: texto)\n"
+            "  -j  grava uma linha JSON por execução com a instrumentação (\"-\" = saída de erro)\n"
+            "  -w  grava a carga em `saida` (.bin = binário, senão CSV) e sai\n"
+            "  -x  grava o rastro binário dos intervalos de cada execução em `rastro`\n"
+            "  -d  escreve em texto o rastro binário gravado com -x e sai\n"
+            "  -e  simula em fluxo, sem carregar a carga inteira (arquivo em ordem de chegada, uma CPU)\n"
+            "  arquivo  carga de trabalho em texto/CSV ou binário (\"-\" para entrada padrão)\n"
+            "Modo varredura (saída CSV com média e intervalo de confiança de 95%%; sem -j nem -x):\n"
+            "  -p  quanta do RR e do MLFQ, cada um uma combinação (padrão: só o de -q)\n"
+            "  -k  amostras por combinação (padrão: %d com -g, %d com arquivo)\n"
+            "  -t  threads (padrão: uma por núcleo)\n"
+            "  -g  gera as cargas: uniforme, poisson, pareto, simultanea ou esparsa\n"
+            "  -n  processos por carga gerada (padrão: %d)\n"
+            "  -s  semente da primeira amostra (padrão: 1)\n",
+            programa, programa, programa, programa, QUANTUM_PADRAO, padrao_cfs.latencia_alvo, padrao_cfs.granularidade_minima,
+            AMOSTRAS_PADRAO_GERADAS, AMOSTRAS_PADRAO_ARQUIVO, PROCESSOS_GERADOS_PADRAO);
+}
+
+// Lê toda a entrada padrão para a memória (não é possível mapear um pipe)
+static char* ler_entrada_padrao(size_t *tamanho) {
+    size_t capacidade = 1 << 16;
+    char *dados = malloc(capacidade);
+    size_t lido;
+
+    *tamanho = 0;
+    while (dados != NULL && (lido = fread(dados + *tamanho, 1, capacidade - *tamanho, stdin)) > 0) {
+        *tamanho += lido;
+        if (*tamanho == capacidade) {
+            capacidade *= 2;
+            char *temp = realloc(dados, capacidade);
+            if (temp == NULL) {
+                free(dados);
+                return NULL;
+            }
+            dados = temp;
+        }
+    }
+    return dados;
+}
+
+// Lê uma lista de inteiros positivos ("2,4,8") com até `maximo` valores
+// Retorna a quantidade lida, ou 0 se a lista for inválida
+static int ler_lista(const char *texto, int *valores, int maximo) {
+    char *fim;
+    int n = 0;
+    do {
+        long q = strtol(texto, &fim, 10);
+        if (fim == texto || q < 1 || n == maximo) {
+            return 0;
+        }
+        valores[n++] = (int)q;
+        texto = fim + 1;
+    } while (*fim == ',');
+    return *fim == '\0' ? n : 0;
+}
+
+// Ajustes dos parâmetros pedidos na linha de comando (NULL ou -1 = padrão)
+typedef struct {
+    const char *quanta_mlfq;
+    int periodo_boost;
+    int latencia_cfs;
+    int granularidade_cfs;
+} AjustesParametros;
+
+// Parâmetros padrão a partir do quantum, com os ajustes pedidos
+// Retorna 0 se a lista de quanta do MLFQ for inválida
+static int montar_parametros(int quantum, const AjustesParametros *ajustes, ParametrosSimulacao *parametros) {
+    parametros_padrao(parametros, quantum);
+    if (ajustes->quanta_mlfq != NULL) {
+        parametros->mlfq.n_niveis = ler_lista(ajustes->quanta_mlfq, parametros->mlfq.quanta, MAX_NIVEIS_MLFQ);
+        if (parametros->mlfq.n_niveis == 0) {
+            return 0;
+        }
+    }
+    if (ajustes->periodo_boost >= 0) {
+        parametros->mlfq.periodo_boost = ajustes->periodo_boost;
+    }
+    if (ajustes->latencia_cfs >= 0) {
+        parametros->cfs.latencia_alvo = ajustes->latencia_cfs;
+    }
+    if (ajustes->granularidade_cfs >= 0) {
+        parametros->cfs.granularidade_minima = ajustes->granularidade_cfs;
+    }
+    return 1;
+}
+
+// Modo varredura: monta as combinações, executa todas as amostras em paralelo
+// e escreve uma linha CSV por combinação. Retorna o código de saída do programa
+static int executar_modo_varredura(const CargaVarredura *carga, Algoritmo primeiro, Algoritmo ultimo,
+                                   const int *quanta, int n_quanta, const AjustesParametros *ajustes,
+                                   const ConfigMultiCPU *config, int threads) {
+    // Só RR e MLFQ dependem do quantum; os demais rodam uma vez com o primeiro
+    int total = 0;
+    for (int a = primeiro; a <= (int)ultimo; a++) {
+        total += (a == ALGORITMO_ROUND_ROBIN || a == ALGORITMO_MLFQ) ? n_quanta : 1;
+    }
+    if ((long long)carga->amostras * total > INT_MAX) {
+        fprintf(stderr, "Amostras demais: %d amostras × %d combinações\n", carga->amostras, total);
+        return 2;
+    }
+
+    ConfiguracaoVarredura *configuracoes = malloc(total * sizeof(ConfiguracaoVarredura));
+    ResumoVarredura *resumos = malloc(total * sizeof(ResumoVarredura));
+    if (configuracoes == NULL || resumos == NULL) {
+        free(configuracoes);
+        free(resumos);
+        fprintf(stderr, "Memória insuficiente\n");
+        return 1;
+    }
+
+    int n_configuracoes = 0;
+    for (int a = primeiro; a <= (int)ultimo; a++) {
+        int variacoes = (a == ALGORITMO_ROUND_ROBIN || a == ALGORITMO_MLFQ) ? n_quanta : 1;
+        for (int k = 0; k < variacoes; k++) {
+            ConfiguracaoVarredura *c = &configuracoes[n_configuracoes++];
+            c->algoritmo = (Algoritmo)a;
+            c->cpus = *config;
+            montar_parametros(quanta[k], ajustes, &c->parametros);
+        }
+    }
+
+    BufferSaida saida;
+    buffer_inicializar(&saida);
+    int ok = executar_varredura(carga, configuracoes, n_configuracoes, threads, resumos);
+    if (ok == 1) {
+        formatar_cabecalho_varredura_csv(&saida);
+        for (int c = 0; c < n_configuracoes; c++) {
+            formatar_varredura_csv(&configuracoes[c], &resumos[c], &saida);
+        }
+        fwrite(saida.dados, 1, saida.tamanho, stdout);
+    } else if (ok < 0) {
+        fprintf(stderr, "Carga com %d processos: tempos além do limite da simulação\n", carga->n);
+    } else {
+        fprintf(stderr, "Memória insuficiente\n");
+    }
+
+    buffer_liberar(&saida);
+    free(configuracoes);
+    free(resumos);
+    return ok == 1 ? 0 : 1;
+}
+
+// Abre o destino das linhas JSON (-j, "-" = saída de erro) e o rastro (-x), se pedidos
+// Retorna 0 (com a mensagem já escrita) se algum não puder ser criado
+static int abrir_saidas(const char *caminho_json, FILE **json, const char *caminho_rastro, EscritorRastro *rastro) {
+    *json = NULL;
+    if (caminho_json != NULL) {
+        *json = strcmp(caminho_json, "-") == 0 ? stderr : fopen(caminho_json, "w");
+        if (*json == NULL) {
+            perror(caminho_json);
+            return 0;
+        }
+    }
+    if (caminho_rastro != NULL) {
+        StatusCarga status = rastro_abrir_escrita(rastro, caminho_rastro);
+        if (status != CARGA_OK) {
+            fprintf(stderr, "%s: %s\n", caminho_rastro, descrever_status_carga(status));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Fecha as saídas de abrir_saidas (rastro NULL = sem rastro); retorna 0 se o rastro não pôde ser gravado
+static int fechar_saidas(FILE *json, const char *caminho_rastro, EscritorRastro *rastro) {
+    if (json != NULL && json != stderr) {
+        fclose(json);
+    }
+    if (rastro != NULL && rastro_fechar_escrita(rastro) != CARGA_OK) {
+        fprintf(stderr, "%s: %s\n", caminho_rastro, descrever_status_carga(CARGA_ERRO_ARQUIVO));
+        return 0;
+    }
+    return 1;
+}
+
+// Origem da carga no modo fluxo: o arquivo ou o gerador
+typedef struct {
+    const char *caminho;                // NULL = carga gerada
+    TipoCarga tipo;
+    int n;
+    unsigned long long semente;
+    LeitorCarga leitor;
+    GeradorCarga gerador;
+} OrigemFluxo;
+
+static int proximo_do_arquivo(void *contexto, Processo *p) {
+    return carga_ler_proximo(&((OrigemFluxo*)contexto)->leitor, p);
+}
+
+static int proximo_do_gerador(void *contexto, Processo *p) {
+    return gerador_proximo(&((OrigemFluxo*)contexto)->gerador, p);
+}
+
+// Linhas CSV do modo fluxo, escritas em blocos à medida que os processos terminam
+typedef struct {
+    Algoritmo algoritmo;
+    BufferSaida *saida;
+} SaidaFluxo;
+
+static void escrever_metrica_fluxo(void *contexto, const MetricaProcesso *metrica) {
+    SaidaFluxo *s = contexto;
+    formatar_metrica_csv(s->algoritmo, metrica, s->saida);
+    if (s->saida->tamanho >= BLOCO_SAIDA_FLUXO) {
+        fwrite(s->saida->dados, 1, s->saida->tamanho, stdout);
+        buffer_limpar(s->saida);
+    }
+}
+
+// Modo fluxo: executa cada algoritmo lendo a carga desde o início.
+// Retorna o código de saída do programa
+static int executar_modo_fluxo(OrigemFluxo *origem, Algoritmo primeiro, Algoritmo ultimo,
+                               const ParametrosSimulacao *parametros, FormatoSaida formato,
+                               FILE *json, EscritorRastro *rastro) {
+    ResultadoSimulacao res;
+    BufferSaida saida;
+    resultado_inicializar(&res);
+    buffer_inicializar(&saida);
+    res.rastro = rastro;
+
+    if (formato == SAIDA_CSV) {
+        formatar_cabecalho_csv(&saida);
+    }
+
+    int codigo = 0;
+    for (int a = primeiro; a <= (int)ultimo && codigo == 0; a++) {
+        FonteProcessos fonte;
+        fonte.contexto = origem;
+        if (origem->caminho != NULL) {
+            StatusCarga status = carga_abrir_fluxo(&origem->leitor, origem->caminho);
+            if (status != CARGA_OK) {
+                fprintf(stderr, "%s: %s\n", origem->caminho, descrever_status_carga(status));
+                codigo = 1;
+                break;
+            }
+            fonte.proximo = proximo_do_arquivo;
+        } else {
+            gerador_inicializar(&origem->gerador, origem->tipo, origem->n, origem->semente);
+            fonte.proximo = proximo_do_gerador;
+        }
+        if (rastro != NULL) {
+            rastro_iniciar_execucao(rastro, (Algoritmo)a, 1);
+        }
+
+        SaidaFluxo destino = { (Algoritmo)a, &saida };
+        int ok = simular_em_fluxo((Algoritmo)a, parametros, &fonte,
+                                  formato == SAIDA_CSV ? escrever_metrica_fluxo : NULL, &destino, &res);
+        if (ok < 0) {
+            fprintf(stderr, "%s: o relógio da simulação passou do limite de tempo\n", nome_algoritmo((Algoritmo)a));
+            codigo = 1;
+        } else if (!ok && origem->caminho == NULL) {
+            fprintf(stderr, "Carga %s com %d processos: chegadas além do limite de tempo\n",
+                    nome_tipo_carga(origem->tipo), origem->n);
+            codigo = 1;
+        } else if (!ok) {
+            const LeitorCarga *l = &origem->leitor;
+            if (!l->binario && l->linha > 0) {
+                fprintf(stderr, "%s: %s (linha %d)\n", origem->caminho, descrever_status_carga(l->status), l->linha);
+            } else if (l->binario && l->status == CARGA_ERRO_FORMATO) {
+                fprintf(stderr, "%s: %s (registro %d)\n", origem->caminho, descrever_status_carga(l->status), l->lidos + 1);
+            } else {
+                fprintf(stderr, "%s: %s\n", origem->caminho, descrever_status_carga(l->status));
+            }
+            codigo = 1;
+        }
+        if (origem->caminho != NULL) {
+            carga_fechar_fluxo(&origem->leitor);
+        }
+
+        if (formato != SAIDA_CSV && codigo == 0) {
+            formatar_resumo_texto(&res, &saida);
+            buffer_anexar(&saida, "\n");
+        }
+        fwrite(saida.dados, 1, saida.tamanho, stdout);
+        fflush(stdout);
+        buffer_limpar(&saida);
+
+        if (json != NULL && codigo == 0) {
+            formatar_instrumentacao_json(&res, &saida);
+            fwrite(saida.dados, 1, saida.tamanho, json);
+            fflush(json);
+            buffer_limpar(&saida);
+        }
+    }
+
+    buffer_liberar(&saida);
+    res.rastro = NULL;
+    resultado_liberar(&res);
+    return codigo;
+}
+
+// Verdadeiro se o caminho termina com a extensão informada
+static int tem_extensao(const char *caminho, const char *extensao) {
+    size_t n = strlen(caminho), m = strlen(extensao);
+    return n >= m && strcmp(caminho + n - m, extensao) == 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *caminho = NULL;
+    const char *caminho_saida = NULL;
+    const char *caminho_json = NULL;
+    const char *caminho_rastro = NULL;  // -x
+    const char *rastro_despejado = NULL; // -d
+    const char *nome_alg = "todos";
+    int quantum = QUANTUM_PADRAO;
+    FormatoSaida formato = SAIDA_TEXTO;
+    ConfigMultiCPU config;
+    AjustesParametros ajustes = { NULL, -1, -1, -1 };
+    const char *lista_quanta = NULL;    // -p
+    const char *nome_carga = NULL;      // -g
+    int n_gerados = PROCESSOS_GERADOS_PADRAO;
+    unsigned long long semente = 1;
+    int amostras = 0;                   // 0 = padrão do modo varredura
+    int threads = 0;                    // 0 = uma por núcleo
+    int fluxo = 0;                      // -e
+
+    multicpu_config_padrao(&config);
+
+    // Interpreta os argumentos
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            nome_alg = argv[++i];
+        } else if (strcmp(argv[i], "-q") == 0 && i + 1 < argc) {
+            quantum = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            config.n_cpus = atoi(argv[++i]);
+            if (config.n_cpus < 1 || config.n_cpus > MAX_CPUS) {
+                fprintf(stderr, "Quantidade de CPUs inválida: %s (de 1 a %d)\n", argv[i], MAX_CPUS);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "-e") == 0) {
+            fluxo = 1;
+        } else if (strcmp(argv[i], "-r") == 0) {
+            config.roubo = 1;
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            config.custo_migracao = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-Q") == 0 && i + 1 < argc) {
+            ajustes.quanta_mlfq = argv[++i];
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            ajustes.periodo_boost = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-L") == 0 && i + 1 < argc) {
+            ajustes.latencia_cfs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-G") == 0 && i + 1 < argc) {
+            ajustes.granularidade_cfs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            lista_quanta = argv[++i];
+        } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            amostras = atoi(argv[++i]);
+            if (amostras < 1) {
+                mostrar_uso(argv[0]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            nome_carga = argv[++i];
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            n_gerados = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            semente = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            caminho_json = argv[++i];
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            caminho_saida = argv[++i];
+        } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            caminho_rastro = argv[++i];
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            rastro_despejado = argv[++i];
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            const char *f = argv[++i];
+            if (strcmp(f, "texto") == 0) {
+                formato = SAIDA_TEXTO;
+            } else if (strcmp(f, "csv") == 0) {
+                formato = SAIDA_CSV;
+            } else if (strcmp(f, "resumo") == 0) {
+                formato = SAIDA_RESUMO;
+            } else {
+                mostrar_uso(argv[0]);
+                return 2;
+            }
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            mostrar_uso(argv[0]);
+            return 2;
+        } else {
+            caminho = argv[i];
+        }
+    }
+
+    // Despejo do rastro: não há carga nem simulação
+    if (rastro_despejado != NULL) {
+        StatusCarga status = rastro_despejar_texto(rastro_despejado, stdout);
+        if (status != CARGA_OK) {
+            fprintf(stderr, "%s: %s\n", rastro_despejado, descrever_status_carga(status));
+            return 1;
+        }
+        return 0;
+    }
+
+    int modo_varredura = !fluxo && (lista_quanta != NULL || nome_carga != NULL || amostras > 0 || threads > 0);
+    if ((caminho == NULL && nome_carga == NULL) || (nome_carga != NULL && caminho != NULL)) {
+        mostrar_uso(argv[0]);
+        return 2;
+    }
+    if (fluxo && (lista_quanta != NULL || amostras > 0 || threads > 0 || caminho_saida != NULL)) {
+        mostrar_uso(argv[0]);
+        return 2;
+    }
+    if (modo_varredura && (caminho_json != NULL || caminho_rastro != NULL)) {
+        mostrar_uso(argv[0]);
+        return 2;
+    }
+    if (fluxo && config.n_cpus > 1) {
+        fprintf(stderr, "A simulação em fluxo usa uma única CPU\n");
+        return 2;
+    }
+
+    // Parâmetros dos algoritmos: padrão a partir do quantum, com os ajustes pedidos
+    ParametrosSimulacao parametros;
+    if (!montar_parametros(quantum, &ajustes, &parametros)) {
+        fprintf(stderr, "Lista de quanta inválida: %s\n", ajustes.quanta_mlfq);
+        return 2;
+    }
+
+    // Quanta da varredura: a lista de -p ou apenas o de -q
+    int quanta[MAX_QUANTA_VARREDURA] = { quantum };
+    int n_quanta = 1;
+    if (lista_quanta != NULL) {
+        n_quanta = ler_lista(lista_quanta, quanta, MAX_QUANTA_VARREDURA);
+        if (n_quanta == 0) {
+            fprintf(stderr, "Lista de quanta inválida: %s\n", lista_quanta);
+            return 2;
+        }
+    }
+
+    CargaVarredura carga_varredura;
+    carga_varredura.processos = NULL;
+    carga_varredura.ordem = NULL;
+    carga_varredura.n = n_gerados;
+    carga_varredura.tipo = CARGA_UNIFORME;
+    carga_varredura.semente = semente;
+    carga_varredura.amostras = amostras > 0 ? amostras
+                               : nome_carga != NULL ? AMOSTRAS_PADRAO_GERADAS : AMOSTRAS_PADRAO_ARQUIVO;
+    if (nome_carga != NULL && (!tipo_carga_por_nome(nome_carga, &carga_varredura.tipo) || n_gerados < 1
+                               || n_gerados > maximo_processos_carga(carga_varredura.tipo))) {
+        fprintf(stderr, "Carga sintética inválida: %s com %d processos\n", nome_carga, n_gerados);
+        return 2;
+    }
+
+    // Seleciona o algoritmo (ou todos)
+    Algoritmo primeiro = ALGORITMO_FIFO, ultimo = N_ALGORITMOS - 1;
+    if (strcmp(nome_alg, "todos") != 0) {
+        if (!algoritmo_por_nome(nome_alg, &primeiro)) {
+            fprintf(stderr, "Algoritmo desconhecido: %s\n", nome_alg);
+            return 2;
+        }
+        ultimo = primeiro;
+    }
+    if (fluxo && caminho != NULL && strcmp(caminho, "-") == 0 && primeiro != ultimo) {
+        fprintf(stderr, "A entrada padrão só pode ser lida em fluxo por um algoritmo (use -a)\n");
+        return 2;
+    }
+
+    // Cargas geradas não passam pela leitura de arquivo
+    if (nome_carga != NULL && !fluxo) {
+        return executar_modo_varredura(&carga_varredura, primeiro, ultimo, quanta, n_quanta,
+                                       &ajustes, &config, threads);
+    }
+
+    if (fluxo) {
+        OrigemFluxo origem;
+        origem.caminho = caminho;
+        origem.tipo = carga_varredura.tipo;
+        origem.n = n_gerados;
+        origem.semente = semente;
+
+        FILE *json = NULL;
+        EscritorRastro rastro;
+        if (!abrir_saidas(caminho_json, &json, caminho_rastro, &rastro)) {
+            return 1;
+        }
+        int codigo = executar_modo_fluxo(&origem, primeiro, ultimo, &parametros, formato, json,
+                                         caminho_rastro != NULL ? &rastro : NULL);
+        if (!fechar_saidas(json, caminho_rastro, caminho_rastro != NULL ? &rastro : NULL)) {
+            codigo = 1;
+        }
+        return codigo;
+    }
+
+    // Carrega a carga de trabalho
+    ListaProcessos lista_processos;
+    Processo *vetor = NULL;
+    int n_processos = 0;
+    int linha_erro = 0;
+    StatusCarga status;
+
+    if (strcmp(caminho, "-") == 0) {
+        size_t tamanho;
+        char *dados = ler_entrada_padrao(&tamanho);
+        status = dados ? carregar_carga_memoria(dados, tamanho, &vetor, &n_processos, &linha_erro)
+                       : CARGA_ERRO_MEMORIA;
+        free(dados);
+    } else {
+        status = carregar_carga(caminho, &vetor, &n_processos, &linha_erro);
+    }
+
+    if (status != CARGA_OK) {
+        if (status == CARGA_ERRO_FORMATO && linha_erro > 0) {
+            fprintf(stderr, "%s: %s (linha %d)\n", caminho, descrever_status_carga(status), linha_erro);
+        } else if (status == CARGA_ERRO_FORMATO && linha_erro < 0) {
+            fprintf(stderr, "%s: %s (registro %d)\n", caminho, descrever_status_carga(status), -linha_erro);
+        } else {
+            fprintf(stderr, "%s: %s\n", caminho, descrever_status_carga(status));
+        }
+        return 1;
+    }
+
+    // A lista assume o vetor lido e indexa os PIDs
+    inicializar_lista(&lista_processos);
+    int substituida = substituir_lista(&lista_processos, vetor, n_processos);
+    if (substituida <= 0) {
+        fprintf(stderr, "%s: %s\n", caminho,
+                substituida < 0 ? descrever_status_carga(CARGA_ERRO_MEMORIA) : "PIDs repetidos");
+        return 1;
+    }
+
+    // Modo de conversão: apenas grava a carga no formato pedido
+    if (caminho_saida != NULL) {
+        status = tem_extensao(caminho_saida, ".bin")
+                     ? salvar_carga_binaria(caminho_saida, lista_processos.itens, lista_processos.n)
+                     : salvar_carga_csv(caminho_saida, lista_processos.itens, lista_processos.n);
+        reinicializar_lista(&lista_processos);
+        if (status != CARGA_OK) {
+            fprintf(stderr, "%s: %s\n", caminho_saida, descrever_status_carga(status));
+            return 1;
+        }
+        return 0;
+    }
+
+    if (modo_varredura) {
+        carga_varredura.processos = lista_processos.itens;
+        carga_varredura.ordem = ordem_por_chegada(&lista_processos);
+        carga_varredura.n = lista_processos.n;
+        int codigo = executar_modo_varredura(&carga_varredura, primeiro, ultimo, quanta, n_quanta,
+                                             &ajustes, &config, threads);
+        reinicializar_lista(&lista_processos);
+        return codigo;
+    }
+
+    ResultadoSimulacao res;
+    BufferSaida saida;
+    resultado_inicializar(&res);
+    buffer_inicializar(&saida);
+
+    if (formato == SAIDA_CSV) {
+        formatar_cabecalho_csv(&saida);
+    }
+
+    // Destino das linhas JSON da instrumentação e rastro binário, gravado pelo
+    // resultado durante cada simulação
+    FILE *json = NULL;
+    EscritorRastro rastro;
+    if (!abrir_saidas(caminho_json, &json, caminho_rastro, &rastro)) {
+        return 1;
+    }
+    if (caminho_rastro != NULL) {
+        res.rastro = &rastro;
+    }
+
+    // Executa cada algoritmo e escreve o resultado assim que ele termina
+    int codigo = 0;
+    for (int a = primeiro; a <= (int)ultimo; a++) {
+        // Algoritmos sem versão com várias CPUs rodam em uma CPU
+        int varias_cpus = config.n_cpus > 1 && multicpu_suporta((Algoritmo)a);
+        if (res.rastro != NULL) {
+            rastro_iniciar_execucao(res.rastro, (Algoritmo)a, varias_cpus ? config.n_cpus : 1);
+        }
+        if (varias_cpus) {
+            simular_multicpu((Algoritmo)a, lista_processos.itens, lista_processos.n,
+                             ordem_por_chegada(&lista_processos), quantum, &config, &res);
+        } else {
+            simular_com_parametros((Algoritmo)a, lista_processos.itens, lista_processos.n,
+                                   ordem_por_chegada(&lista_processos), &parametros, &res);
+        }
+        if (res.estouro_relogio) {
+            fprintf(stderr, "%s: o relógio da simulação passou do limite de tempo\n", nome_algoritmo((Algoritmo)a));
+            codigo = 1;
+            break;
+        }
+
+        INSTR_INICIAR_FASE(&res, FASE_FORMATACAO);
+        if (formato == SAIDA_CSV) {
+            formatar_resultado_csv(&res, &saida);
+        } else if (formato == SAIDA_RESUMO) {
+            formatar_resumo_texto(&res, &saida);
+            buffer_anexar(&saida, "\n");
+        } else {
+            formatar_resultado_texto(&res, &saida);
+            buffer_anexar(&saida, "\n");
+        }
+        INSTR_ENCERRAR_FASE(&res, FASE_FORMATACAO);
+
+        fwrite(saida.dados, 1, saida.tamanho, stdout);
+        fflush(stdout);
+        buffer_limpar(&saida);
+
+        if (json != NULL) {
+            formatar_instrumentacao_json(&res, &saida);
+            fwrite(saida.dados, 1, saida.tamanho, json);
+            fflush(json);
+            buffer_limpar(&saida);
+        }
+    }
+
+    if (!fechar_saidas(json, caminho_rastro, res.rastro)) {
+        codigo = 1;
+    }
+
+    buffer_liberar(&saida);
+    resultado_liberar(&res);
+    reinicializar_lista(&lista_processos);
+    return codigo;
+}
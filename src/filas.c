@@ -0,0 +1,547 @@
+/**
+ * @file filas.c
+ * @brief Implementação das filas de prontos dos algoritmos de escalonamento.
+ *
+ * O heap binário permite escolher o próximo processo em O(log n), em vez de
+ * percorrer a lista inteira de processos a cada decisão do escalonador.
+ * A fila circular mantém apenas os processos prontos, na ordem de atendimento.
+ * A árvore rubro-negra segue o algoritmo clássico (Cormen et al.), com uma
+ * folha nula sentinela e o nó mais à esquerda guardado para consulta em O(1).
+ * O conjunto de prontos troca o O(log n) do heap por uma varredura sem desvios
+ * sobre vetores contíguos, que em cargas pequenas cabem inteiros na cache L1.
+ */
+
+#include <stdlib.h>     // malloc, realloc, calloc, free, abort
+#include <stdint.h>     // uintptr_t
+#include <limits.h>     // INT_MAX
+#include "filas.h"
+
+// A versão AVX2 é compilada com o atributo target do GCC e só é usada se o
+// processador a suportar; nos demais casos (ou compiladores) fica a escalar
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CONJUNTO_AVX2 1
+#endif
+
+// Retorna verdadeiro se o item a deve sair do heap antes do item b
+static int vem_antes(const ItemHeap *a, const ItemHeap *b) {
+    if (a->chave != b->chave) return a->chave < b->chave;
+    if (a->pid != b->pid) return a->pid < b->pid;
+    return a->indice < b->indice;   // PIDs repetidos: mantém a ordem da lista
+}
+
+void heap_inicializar(HeapMin *heap, int capacidade) {
+    if (capacidade < 1) capacidade = 1;
+    heap->itens = malloc(capacidade * sizeof(ItemHeap));
+    if (heap->itens == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    heap->tamanho = 0;
+    heap->capacidade = capacidade;
+}
+
+void heap_inserir(HeapMin *heap, int chave, int pid, int indice) {
+    // Dobra a capacidade quando o vetor estiver cheio
+    if (heap->tamanho == heap->capacidade) {
+        ItemHeap *temp = realloc(heap->itens, 2 * heap->capacidade * sizeof(ItemHeap));
+        if (temp == NULL) {
+            abort();            // Sem memória não há como continuar a simulação
+        }
+        heap->itens = temp;
+        heap->capacidade *= 2;
+    }
+
+    ItemHeap novo = { chave, pid, indice };
+    int i = heap->tamanho++;
+
+    // Sobe o novo item enquanto ele for menor que o pai
+    while (i > 0) {
+        int pai = (i - 1) / 2;
+        if (!vem_antes(&novo, &heap->itens[pai])) break;
+        heap->itens[i] = heap->itens[pai];
+        i = pai;
+    }
+    heap->itens[i] = novo;
+}
+
+ItemHeap heap_remover_min(HeapMin *heap) {
+    ItemHeap topo = heap->itens[0];
+    ItemHeap ultimo = heap->itens[--heap->tamanho];
+    int i = 0;
+
+    // Desce o último item a partir da raiz até a posição correta
+    for (;;) {
+        int filho = 2 * i + 1;
+        if (filho >= heap->tamanho) break;
+        if (filho + 1 < heap->tamanho && vem_antes(&heap->itens[filho + 1], &heap->itens[filho])) {
+            filho++;
+        }
+        if (!vem_antes(&heap->itens[filho], &ultimo)) break;
+        heap->itens[i] = heap->itens[filho];
+        i = filho;
+    }
+    if (heap->tamanho > 0) {
+        heap->itens[i] = ultimo;
+    }
+    return topo;
+}
+
+void heap_liberar(HeapMin *heap) {
+    free(heap->itens);
+    heap->itens = NULL;
+    heap->tamanho = 0;
+    heap->capacidade = 0;
+}
+
+void fila_inicializar(FilaCircular *fila, int capacidade) {
+    if (capacidade < 1) capacidade = 1;
+    fila->itens = malloc(capacidade * sizeof(int));
+    if (fila->itens == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    fila->inicio = 0;
+    fila->tamanho = 0;
+    fila->capacidade = capacidade;
+}
+
+void fila_inserir(FilaCircular *fila, int indice) {
+    // Fila cheia: dobra a capacidade e desenrola os itens para o começo do novo vetor
+    if (fila->tamanho == fila->capacidade) {
+        int *novo = malloc(2 * fila->capacidade * sizeof(int));
+        if (novo == NULL) {
+            abort();            // Sem memória não há como continuar a simulação
+        }
+        for (int i = 0; i < fila->tamanho; i++) {
+            novo[i] = fila->itens[(fila->inicio + i) % fila->capacidade];
+        }
+        free(fila->itens);
+        fila->itens = novo;
+        fila->inicio = 0;
+        fila->capacidade *= 2;
+    }
+
+    fila->itens[(fila->inicio + fila->tamanho) % fila->capacidade] = indice;
+    fila->tamanho++;
+}
+
+int fila_remover(FilaCircular *fila) {
+    int indice = fila->itens[fila->inicio];
+    fila->inicio = (fila->inicio + 1) % fila->capacidade;
+    fila->tamanho--;
+    return indice;
+}
+
+void fila_liberar(FilaCircular *fila) {
+    free(fila->itens);
+    fila->itens = NULL;
+    fila->inicio = 0;
+    fila->tamanho = 0;
+    fila->capacidade = 0;
+}
+
+// Retorna verdadeiro se o nó a vem antes (mais à esquerda) do nó b
+static int no_antes(const NoArvore *a, const NoArvore *b) {
+    if (a->chave != b->chave) return a->chave < b->chave;
+    return a->pid < b->pid;
+}
+
+void arvore_inicializar(ArvoreRN *arvore, int capacidade) {
+    if (capacidade < 0) {
+        capacidade = 0;
+    }
+    arvore->nos = malloc((capacidade + 1) * sizeof(NoArvore));
+    arvore->capacidade = capacidade;
+    arvore->raiz = capacidade;
+    arvore->minimo = capacidade;
+    arvore->tamanho = 0;
+    arvore->nos[capacidade].vermelho = 0;   // A folha nula é sempre preta
+}
+
+void arvore_crescer(ArvoreRN *arvore, int capacidade) {
+    int antigo = arvore->capacidade;
+    if (capacidade <= antigo) {
+        return;
+    }
+    NoArvore *nos = realloc(arvore->nos, (capacidade + 1) * sizeof(NoArvore));
+    if (nos == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+
+    // A folha nula passa da posição antiga para a nova; nós fora da árvore
+    // também são ajustados, mas seus campos são sobrescritos ao serem inseridos
+    nos[capacidade] = nos[antigo];
+    for (int i = 0; i < antigo; i++) {
+        if (nos[i].esquerda == antigo) nos[i].esquerda = capacidade;
+        if (nos[i].direita == antigo) nos[i].direita = capacidade;
+        if (nos[i].pai == antigo) nos[i].pai = capacidade;
+    }
+    if (arvore->raiz == antigo) arvore->raiz = capacidade;
+    if (arvore->minimo == antigo) arvore->minimo = capacidade;
+    arvore->nos = nos;
+    arvore->capacidade = capacidade;
+}
+
+static void rotacionar_esquerda(ArvoreRN *arvore, int x) {
+    NoArvore *nos = arvore->nos;
+    int nulo = arvore->capacidade;
+    int y = nos[x].direita;
+    nos[x].direita = nos[y].esquerda;
+    if (nos[y].esquerda != nulo) {
+        nos[nos[y].esquerda].pai = x;
+    }
+    nos[y].pai = nos[x].pai;
+    if (nos[x].pai == nulo) {
+        arvore->raiz = y;
+    } else if (x == nos[nos[x].pai].esquerda) {
+        nos[nos[x].pai].esquerda = y;
+    } else {
+        nos[nos[x].pai].direita = y;
+    }
+    nos[y].esquerda = x;
+    nos[x].pai = y;
+}
+
+static void rotacionar_direita(ArvoreRN *arvore, int x) {
+    NoArvore *nos = arvore->nos;
+    int nulo = arvore->capacidade;
+    int y = nos[x].esquerda;
+    nos[x].esquerda = nos[y].direita;
+    if (nos[y].direita != nulo) {
+        nos[nos[y].direita].pai = x;
+    }
+    nos[y].pai = nos[x].pai;
+    if (nos[x].pai == nulo) {
+        arvore->raiz = y;
+    } else if (x == nos[nos[x].pai].direita) {
+        nos[nos[x].pai].direita = y;
+    } else {
+        nos[nos[x].pai].esquerda = y;
+    }
+    nos[y].direita = x;
+    nos[x].pai = y;
+}
+
+void arvore_inserir(ArvoreRN *arvore, int indice, long long chave, int pid) {
+    NoArvore *nos = arvore->nos;
+    int nulo = arvore->capacidade;
+    NoArvore *z = &nos[indice];
+    z->chave = chave;
+    z->pid = pid;
+    z->esquerda = z->direita = nulo;
+    z->vermelho = 1;
+
+    // Desce até a folha onde o nó entra; se só andou para a esquerda, é o novo mínimo
+    int pai = nulo;
+    int atual = arvore->raiz;
+    int so_esquerda = 1;
+    while (atual != nulo) {
+        pai = atual;
+        if (no_antes(z, &nos[atual])) {
+            atual = nos[atual].esquerda;
+        } else {
+            atual = nos[atual].direita;
+            so_esquerda = 0;
+        }
+    }
+    z->pai = pai;
+    if (pai == nulo) {
+        arvore->raiz = indice;
+    } else if (no_antes(z, &nos[pai])) {
+        nos[pai].esquerda = indice;
+    } else {
+        nos[pai].direita = indice;
+    }
+    if (so_esquerda) {
+        arvore->minimo = indice;
+    }
+    arvore->tamanho++;
+
+    // Corrige as cores: sobe enquanto houver dois vermelhos seguidos
+    int x = indice;
+    while (nos[nos[x].pai].vermelho) {
+        int p = nos[x].pai;
+        int avo = nos[p].pai;
+        if (p == nos[avo].esquerda) {
+            int tio = nos[avo].direita;
+            if (nos[tio].vermelho) {
+                nos[p].vermelho = nos[tio].vermelho = 0;
+                nos[avo].vermelho = 1;
+                x = avo;
+            } else {
+                if (x == nos[p].direita) {
+                    x = p;
+                    rotacionar_esquerda(arvore, x);
+                    p = nos[x].pai;
+                }
+                nos[p].vermelho = 0;
+                nos[avo].vermelho = 1;
+                rotacionar_direita(arvore, avo);
+            }
+        } else {
+            int tio = nos[avo].esquerda;
+            if (nos[tio].vermelho) {
+                nos[p].vermelho = nos[tio].vermelho = 0;
+                nos[avo].vermelho = 1;
+                x = avo;
+            } else {
+                if (x == nos[p].esquerda) {
+                    x = p;
+                    rotacionar_direita(arvore, x);
+                    p = nos[x].pai;
+                }
+                nos[p].vermelho = 0;
+                nos[avo].vermelho = 1;
+                rotacionar_esquerda(arvore, avo);
+            }
+        }
+    }
+    nos[arvore->raiz].vermelho = 0;
+}
+
+int arvore_minimo(const ArvoreRN *arvore) {
+    return arvore->minimo;
+}
+
+int arvore_seguinte(const ArvoreRN *arvore, int indice) {
+    const NoArvore *nos = arvore->nos;
+    int nulo = arvore->capacidade;
+
+    // Com subárvore direita, o seguinte é o mais à esquerda dela
+    if (nos[indice].direita != nulo) {
+        int x = nos[indice].direita;
+        while (nos[x].esquerda != nulo) {
+            x = nos[x].esquerda;
+        }
+        return x;
+    }
+    // Senão, sobe até chegar por um filho esquerdo
+    int pai = nos[indice].pai;
+    while (pai != nulo && indice == nos[pai].direita) {
+        indice = pai;
+        pai = nos[pai].pai;
+    }
+    return pai;
+}
+
+int arvore_remover_min(ArvoreRN *arvore) {
+    NoArvore *nos = arvore->nos;
+    int nulo = arvore->capacidade;
+    int z = arvore->minimo;
+
+    // O mínimo não tem filho esquerdo: é substituído pelo filho direito
+    int x = nos[z].direita;
+    int pai = nos[z].pai;
+    nos[x].pai = pai;               // Também na folha nula, usada pela correção abaixo
+    if (pai == nulo) {
+        arvore->raiz = x;
+    } else {
+        nos[pai].esquerda = x;
+    }
+
+    // Próximo mínimo: o mais à esquerda do filho direito ou, sem ele, o pai.
+    // As rotações da correção não mudam a ordem dos nós
+    if (x != nulo) {
+        int m = x;
+        while (nos[m].esquerda != nulo) {
+            m = nos[m].esquerda;
+        }
+        arvore->minimo = m;
+    } else {
+        arvore->minimo = pai;
+    }
+    arvore->tamanho--;
+
+    // Remover um nó preto desequilibra as alturas pretas: corrige a partir de x
+    if (!nos[z].vermelho) {
+        while (x != arvore->raiz && !nos[x].vermelho) {
+            int p = nos[x].pai;
+            if (x == nos[p].esquerda) {
+                int w = nos[p].direita;
+                if (nos[w].vermelho) {
+                    nos[w].vermelho = 0;
+                    nos[p].vermelho = 1;
+                    rotacionar_esquerda(arvore, p);
+                    w = nos[p].direita;
+                }
+                if (!nos[nos[w].esquerda].vermelho && !nos[nos[w].direita].vermelho) {
+                    nos[w].vermelho = 1;
+                    x = p;
+                } else {
+                    if (!nos[nos[w].direita].vermelho) {
+                        nos[nos[w].esquerda].vermelho = 0;
+                        nos[w].vermelho = 1;
+                        rotacionar_direita(arvore, w);
+                        w = nos[p].direita;
+                    }
+                    nos[w].vermelho = nos[p].vermelho;
+                    nos[p].vermelho = 0;
+                    nos[nos[w].direita].vermelho = 0;
+                    rotacionar_esquerda(arvore, p);
+                    x = arvore->raiz;
+                }
+            } else {
+                int w = nos[p].esquerda;
+                if (nos[w].vermelho) {
+                    nos[w].vermelho = 0;
+                    nos[p].vermelho = 1;
+                    rotacionar_direita(arvore, p);
+                    w = nos[p].esquerda;
+                }
+                if (!nos[nos[w].direita].vermelho && !nos[nos[w].esquerda].vermelho) {
+                    nos[w].vermelho = 1;
+                    x = p;
+                } else {
+                    if (!nos[nos[w].esquerda].vermelho) {
+                        nos[nos[w].direita].vermelho = 0;
+                        nos[w].vermelho = 1;
+                        rotacionar_esquerda(arvore, w);
+                        w = nos[p].esquerda;
+                    }
+                    nos[w].vermelho = nos[p].vermelho;
+                    nos[p].vermelho = 0;
+                    nos[nos[w].esquerda].vermelho = 0;
+                    rotacionar_direita(arvore, p);
+                    x = arvore->raiz;
+                }
+            }
+        }
+        nos[x].vermelho = 0;
+    }
+    return z;
+}
+
+void arvore_liberar(ArvoreRN *arvore) {
+    free(arvore->nos);
+    arvore->nos = NULL;
+    arvore->raiz = arvore->minimo = 0;
+    arvore->tamanho = 0;
+    arvore->capacidade = 0;
+}
+
+int conjunto_vetorial_disponivel(void) {
+#ifdef CONJUNTO_AVX2
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    return 0;
+#endif
+}
+
+void conjunto_inicializar(ConjuntoPronto *conjunto, int capacidade) {
+    if (capacidade < 1) capacidade = 1;
+    capacidade = (capacidade + 31) & ~31;   // Palavras de bits completas
+
+    // Um bloco para chaves e PIDs, alinhado a 32 bytes (um registrador AVX2)
+    conjunto->bloco = malloc(2 * (size_t)capacidade * sizeof(int) + 32);
+    conjunto->chaves = (int*)(((uintptr_t)conjunto->bloco + 31) & ~(uintptr_t)31);
+    conjunto->pids = conjunto->chaves + capacidade;
+    for (int i = 0; i < capacidade; i++) {
+        conjunto->chaves[i] = INT_MAX;      // Fora do conjunto: nunca menor que uma chave pronta
+        conjunto->pids[i] = 0;
+    }
+    conjunto->prontos = calloc(capacidade / 32, sizeof(unsigned));
+    conjunto->tamanho = 0;
+    conjunto->capacidade = capacidade;
+    conjunto->vetorial = conjunto_vetorial_disponivel();
+}
+
+void conjunto_inserir(ConjuntoPronto *conjunto, int chave, int pid, int indice) {
+    conjunto->chaves[indice] = chave;
+    conjunto->pids[indice] = pid;
+    conjunto->prontos[indice >> 5] |= 1u << (indice & 31);
+    conjunto->tamanho++;
+}
+
+// Posição do bit ligado menos significativo (bits != 0)
+static int menor_bit(unsigned bits) {
+#ifdef __GNUC__
+    return __builtin_ctz(bits);
+#else
+    int b = 0;
+    while (!(bits & 1u)) {
+        bits >>= 1;
+        b++;
+    }
+    return b;
+#endif
+}
+
+// Índice pronto de menor (chave, pid), visitando só os bits ligados
+// Os índices são visitados em ordem crescente, então o menor índice vence o empate
+static int minimo_escalar(const ConjuntoPronto *conjunto) {
+    const int *chaves = conjunto->chaves, *pids = conjunto->pids;
+    int melhor = -1;
+    for (int w = 0; w < conjunto->capacidade / 32; w++) {
+        unsigned bits = conjunto->prontos[w];
+        while (bits != 0) {
+            int i = w * 32 + menor_bit(bits);
+            bits &= bits - 1;
+            if (melhor < 0 || chaves[i] < chaves[melhor] ||
+                (chaves[i] == chaves[melhor] && pids[i] < pids[melhor])) {
+                melhor = i;
+            }
+        }
+    }
+    return melhor;
+}
+
+#ifdef CONJUNTO_AVX2
+// Mesmo resultado de minimo_escalar, 8 índices por instrução
+// Índices fora do conjunto têm chave INT_MAX, então a primeira passada é só
+// carga e mínimo; a segunda procura, entre as chaves iguais ao mínimo, o menor PID
+__attribute__((target("avx2")))
+static int minimo_avx2(const ConjuntoPronto *conjunto) {
+    const int *chaves = conjunto->chaves, *pids = conjunto->pids;
+    __m256i m0 = _mm256_set1_epi32(INT_MAX), m1 = m0;
+    for (int base = 0; base < conjunto->capacidade; base += 16) {
+        m0 = _mm256_min_epi32(m0, _mm256_load_si256((const __m256i*)(chaves + base)));
+        m1 = _mm256_min_epi32(m1, _mm256_load_si256((const __m256i*)(chaves + base + 8)));
+    }
+
+    // Mínimo horizontal das 8 faixas
+    __m128i m = _mm_min_epi32(_mm256_castsi256_si128(_mm256_min_epi32(m0, m1)),
+                              _mm256_extracti128_si256(_mm256_min_epi32(m0, m1), 1));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    const int chave_min = _mm_cvtsi128_si32(m);
+    const __m256i alvo = _mm256_set1_epi32(chave_min);
+
+    int melhor = -1;
+    for (int base = 0; base < conjunto->capacidade; base += 8) {
+        __m256i iguais = _mm256_cmpeq_epi32(_mm256_load_si256((const __m256i*)(chaves + base)), alvo);
+        unsigned bits = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(iguais));
+        bits &= (conjunto->prontos[base >> 5] >> (base & 31)) & 0xFFu;     // Descarta os que não estão prontos
+        while (bits != 0) {
+            int i = base + menor_bit(bits);
+            bits &= bits - 1;
+            if (melhor < 0 || pids[i] < pids[melhor]) {
+                melhor = i;
+            }
+        }
+    }
+    return melhor;
+}
+#endif
+
+ItemHeap conjunto_remover_min(ConjuntoPronto *conjunto) {
+#ifdef CONJUNTO_AVX2
+    int i = conjunto->vetorial ? minimo_avx2(conjunto) : minimo_escalar(conjunto);
+#else
+    int i = minimo_escalar(conjunto);
+#endif
+    ItemHeap item = { conjunto->chaves[i], conjunto->pids[i], i };
+    conjunto->chaves[i] = INT_MAX;
+    conjunto->prontos[i >> 5] &= ~(1u << (i & 31));
+    conjunto->tamanho--;
+    return item;
+}
+
+void conjunto_liberar(ConjuntoPronto *conjunto) {
+    free(conjunto->bloco);
+    free(conjunto->prontos);
+    conjunto->bloco = NULL;
+    conjunto->chaves = NULL;
+    conjunto->pids = NULL;
+    conjunto->prontos = NULL;
+    conjunto->tamanho = 0;
+    conjunto->capacidade = 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file filas.h
+ * @brief Estruturas de fila de prontos usadas pelos algoritmos de escalonamento.
+ *
+ * Define um heap binário de mínimo cujos itens são ordenados por uma chave
+ * (tempo de execução, prioridade, ...) com desempate estável pelo PID, uma
+ * fila circular FIFO usada pelo Round-Robin, uma árvore rubro-negra ordenada
+ * por tempo virtual, usada pelo CFS, e um conjunto de prontos em vetores
+ * separados (SoA) para cargas pequenas, percorrido com instruções vetoriais.
+ */
+
+#ifndef FILAS_H               // Evita inclusão duplicada
+#define FILAS_H
+
+// Item armazenado no heap
+typedef struct {
+    int chave;                // Valor usado na ordenação (menor sai primeiro)
+    int pid;                  // Desempate: em chaves iguais, menor PID sai primeiro
+    int indice;               // Índice do processo na lista de processos
+} ItemHeap;
+
+// Heap binário de mínimo com capacidade dinâmica
+typedef struct {
+    ItemHeap *itens;          // Vetor com os itens do heap
+    int tamanho;              // Quantidade de itens armazenados
+    int capacidade;           // Capacidade alocada do vetor
+} HeapMin;
+
+// Inicializa o heap reservando espaço para `capacidade` itens
+void heap_inicializar(HeapMin *heap, int capacidade);
+
+// Insere um item no heap - O(log n)
+void heap_inserir(HeapMin *heap, int chave, int pid, int indice);
+
+// Remove e retorna o item de menor (chave, pid) - O(log n)
+// Não deve ser chamada com o heap vazio
+ItemHeap heap_remover_min(HeapMin *heap);
+
+// Libera a memória do heap
+void heap_liberar(HeapMin *heap);
+
+// Fila FIFO em buffer circular com capacidade dinâmica
+typedef struct {
+    int *itens;               // Vetor circular com os índices dos processos
+    int inicio;               // Posição do primeiro item da fila
+    int tamanho;              // Quantidade de itens na fila
+    int capacidade;           // Capacidade alocada do vetor
+} FilaCircular;
+
+// Inicializa a fila reservando espaço para `capacidade` itens
+void fila_inicializar(FilaCircular *fila, int capacidade);
+
+// Insere um índice no final da fila - O(1) amortizado
+void fila_inserir(FilaCircular *fila, int indice);
+
+// Remove e retorna o índice do início da fila - O(1)
+// Não deve ser chamada com a fila vazia
+int fila_remover(FilaCircular *fila);
+
+// Libera a memória da fila
+void fila_liberar(FilaCircular *fila);
+
+// Nó da árvore rubro-negra; o nó do processo i fica na posição i do vetor de nós
+typedef struct {
+    long long chave;          // Valor usado na ordenação (menor à esquerda)
+    int pid;                  // Desempate: em chaves iguais, menor PID à esquerda
+    int esquerda;             // Filho esquerdo (posição no vetor; `capacidade` = folha nula)
+    int direita;              // Filho direito
+    int pai;                  // Pai (`capacidade` na raiz)
+    int vermelho;             // Cor do nó: 1 = vermelho, 0 = preto
+} NoArvore;
+
+// Árvore rubro-negra de índices de processos, sem alocação por inserção:
+// cada índice de 0 a capacidade-1 tem um nó fixo e pode estar na árvore uma vez
+typedef struct {
+    NoArvore *nos;            // capacidade + 1 nós; o último é a folha nula (sentinela)
+    int raiz;                 // Nó raiz (`capacidade` = árvore vazia)
+    int minimo;               // Nó mais à esquerda, mantido a cada inserção e remoção
+    int tamanho;              // Quantidade de nós na árvore
+    int capacidade;           // Quantidade de índices possíveis
+} ArvoreRN;
+
+// Inicializa a árvore para os índices 0 a capacidade-1
+void arvore_inicializar(ArvoreRN *arvore, int capacidade);
+
+// Aumenta a quantidade de índices possíveis para `capacidade`, mantendo os nós
+// da árvore - O(capacidade anterior), pois as referências à folha nula mudam
+void arvore_crescer(ArvoreRN *arvore, int capacidade);
+
+// Insere o índice com a chave e o PID informados - O(log n)
+// O índice não pode estar na árvore
+void arvore_inserir(ArvoreRN *arvore, int indice, long long chave, int pid);
+
+// Retorna o índice de menor (chave, pid) sem removê-lo - O(1)
+// Não deve ser chamada com a árvore vazia
+int arvore_minimo(const ArvoreRN *arvore);
+
+// Retorna o índice seguinte a `indice` na ordem (chave, pid), ou `capacidade`
+// se ele for o último - O(log n) no pior caso, O(1) amortizado num percurso
+int arvore_seguinte(const ArvoreRN *arvore, int indice);
+
+// Remove e retorna o índice de menor (chave, pid) - O(log n)
+// Não deve ser chamada com a árvore vazia
+int arvore_remover_min(ArvoreRN *arvore);
+
+// Libera a memória da árvore
+void arvore_liberar(ArvoreRN *arvore);
+
+// O SJF e a Prioridade só usam o conjunto de prontos quando compilados com
+// make VETORIAL=1 e em cargas de até LIMITE_CONJUNTO_PRONTO processos; a busca
+// do mínimo usa AVX2 se o processador tiver e, senão, a varredura escalar dos
+// bits. Nas medições em x86-64, a varredura ganha do heap apenas com muitos
+// processos prontos ao mesmo tempo; na simulação completa o heap empatou ou
+// venceu, e a versão escalar ficou no mesmo patamar da AVX2 (até 128 processos),
+// por isso o padrão continua sendo o heap
+#ifdef ESCALONADOR_CONJUNTO_VETORIAL
+#define CONJUNTO_PRONTO_ATIVO 1
+#else
+#define CONJUNTO_PRONTO_ATIVO 0
+#endif
+#define LIMITE_CONJUNTO_PRONTO 128
+
+// Conjunto de prontos em estrutura de vetores: a chave e o PID do processo i
+// ficam na posição i de dois vetores alinhados, e um bit por processo indica
+// se ele está pronto. Mesma ordem de saída do HeapMin: (chave, pid, indice)
+typedef struct {
+    int *chaves;              // Chave de cada índice (válida apenas se o bit estiver ligado)
+    int *pids;                // PID de cada índice
+    unsigned *prontos;        // Um bit por índice, 32 índices por palavra
+    void *bloco;              // Memória de `chaves` e `pids` antes do alinhamento
+    int tamanho;              // Quantidade de índices prontos
+    int capacidade;           // Quantidade de índices possíveis (múltiplo de 32)
+    int vetorial;             // 1 = usa a versão AVX2, 0 = a escalar (ver conjunto_vetorial_disponivel)
+} ConjuntoPronto;
+
+// Retorna 1 se o processador suporta a versão AVX2 de conjunto_remover_min
+int conjunto_vetorial_disponivel(void);
+
+// Inicializa o conjunto vazio para os índices 0 a capacidade-1
+void conjunto_inicializar(ConjuntoPronto *conjunto, int capacidade);
+
+// Marca o índice como pronto, com a chave e o PID informados - O(1)
+// O índice não pode estar no conjunto
+void conjunto_inserir(ConjuntoPronto *conjunto, int chave, int pid, int indice);
+
+// Remove e retorna o item de menor (chave, pid) - O(capacidade), 8 índices por
+// instrução com AVX2 (sem AVX2, visita um a um os índices prontos)
+// Não deve ser chamada com o conjunto vazio
+ItemHeap conjunto_remover_min(ConjuntoPronto *conjunto);
+
+// Libera a memória do conjunto
+void conjunto_liberar(ConjuntoPronto *conjunto);
+
+#endif
@@ -0,0 +1,466 @@
+/**
+ * @file gantt.c
+ * @brief Desenho do gráfico de Gantt de uma simulação com cairo.
+ *
+ * Cada processo ocupa uma linha horizontal e cada intervalo de execução é um
+ * retângulo nessa linha. Para linhas do tempo longas, os intervalos são
+ * resumidos em uma pirâmide de "baldes" de tempo: cada balde guarda a menor e
+ * a maior linha (processo) que executou nele, e cada nível junta dois baldes
+ * do nível abaixo. No redesenho, cada coluna de pixels consulta no máximo
+ * três baldes do nível cujo tamanho mais se aproxima de um pixel.
+ *
+ * Ampliado além do nível 0, o gráfico desenha os intervalos de cada CPU, que
+ * não se sobrepõem e por isso estão ordenados tanto pelo início quanto pelo
+ * fim. Quando vários intervalos de uma CPU terminam na mesma coluna de pixels,
+ * apenas o primeiro é desenhado e a coluna usa o balde do nível 0.
+ */
+
+#include <math.h>       // floor, ceil, pow, log10
+#include <stdio.h>      // snprintf para os rótulos
+#include <stdlib.h>     // qsort
+#include <string.h>     // memcpy
+#include "gantt.h"
+
+#define MAX_BALDES_BASE (1 << 21)       // Baldes no nível mais detalhado da pirâmide
+#define MARGEM_ESQUERDA 60              // Espaço para os rótulos dos processos (px)
+#define MARGEM_INFERIOR 24              // Espaço para o eixo de tempo (px)
+#define ALTURA_MINIMA_ROTULO 12.0       // Altura mínima da linha para mostrar o PID (px)
+#define ESPACO_MINIMO_MARCAS 80.0       // Distância mínima entre marcas do eixo de tempo (px)
+#define PIXELS_POR_UNIDADE_MAX 64.0     // Ampliação máxima
+
+// Faixa de linhas (índices de processo) que executaram em um balde de tempo
+typedef struct {
+    int min;                // Menor linha (-1 = CPU ociosa em todo o balde)
+    int max;                // Maior linha
+} FaixaLinhas;
+
+// Estado de um gráfico: cópia dos dados, pirâmide de resumo e visão atual
+typedef struct {
+    Intervalo *intervalos;          // Cópia dos intervalos, ordenada por CPU e pelo início
+    int n_intervalos;
+    int *inicio_cpu;                // Intervalos da CPU c: [inicio_cpu[c], inicio_cpu[c + 1])
+    int n_cpus;
+    int *pids;                      // PID de cada linha
+    int n;                          // Quantidade de linhas (processos)
+    long long fim_total;            // Fim do último intervalo
+
+    FaixaLinhas **niveis;           // niveis[0] tem baldes de `balde_base` unidades de tempo
+    int *tamanho_nivel;             // Baldes em cada nível
+    int n_niveis;
+    long long balde_base;           // Unidades de tempo por balde no nível 0
+
+    double inicio_visivel;          // Tempo na borda esquerda da área do gráfico
+    double tempo_por_pixel;         // Escala atual (0 = ajustar à largura no próximo desenho)
+    int arrastando;                 // Botão esquerdo pressionado
+    double arrasto_x;               // Posição do mouse no início do arrasto
+    double arrasto_inicio;          // inicio_visivel no início do arrasto
+} Gantt;
+
+// Une duas faixas de linhas
+static FaixaLinhas unir_faixas(FaixaLinhas a, FaixaLinhas b) {
+    if (a.min < 0) {
+        return b;
+    }
+    if (b.min < 0) {
+        return a;
+    }
+    FaixaLinhas r = { a.min < b.min ? a.min : b.min, a.max > b.max ? a.max : b.max };
+    return r;
+}
+
+// Monta a pirâmide de faixas a partir dos intervalos
+static void construir_piramide(Gantt *g) {
+    long long total = g->fim_total > 0 ? g->fim_total : 1;
+    g->balde_base = (total + MAX_BALDES_BASE - 1) / MAX_BALDES_BASE;
+
+    int tamanho = (int)((total + g->balde_base - 1) / g->balde_base);
+    g->n_niveis = 1;
+    for (int t = tamanho; t > 1; t = (t + 1) / 2) {
+        g->n_niveis++;
+    }
+    g->niveis = g_new(FaixaLinhas *, g->n_niveis);
+    g->tamanho_nivel = g_new(int, g->n_niveis);
+
+    // Nível 0: cada intervalo marca os baldes que cobre (custo total: intervalos + baldes)
+    FaixaLinhas *base = g_new(FaixaLinhas, tamanho);
+    for (int b = 0; b < tamanho; b++) {
+        base[b].min = base[b].max = -1;
+    }
+    for (int k = 0; k < g->n_intervalos; k++) {
+        const Intervalo *it = &g->intervalos[k];
+        if (it->fim <= it->inicio) {
+            continue;               // Processo sem tempo de execução
+        }
+        FaixaLinhas linha = { it->indice, it->indice };
+        long long fim_balde = (it->fim - 1) / g->balde_base;
+        for (long long b = it->inicio / g->balde_base; b <= fim_balde; b++) {
+            base[b] = unir_faixas(base[b], linha);
+        }
+    }
+    g->niveis[0] = base;
+    g->tamanho_nivel[0] = tamanho;
+
+    // Demais níveis: cada balde resume dois baldes do nível anterior
+    for (int l = 1; l < g->n_niveis; l++) {
+        const FaixaLinhas *abaixo = g->niveis[l - 1];
+        int n_abaixo = g->tamanho_nivel[l - 1];
+        int n_nivel = (n_abaixo + 1) / 2;
+        FaixaLinhas *nivel = g_new(FaixaLinhas, n_nivel);
+        for (int b = 0; b < n_nivel; b++) {
+            nivel[b] = (2 * b + 1 < n_abaixo) ? unir_faixas(abaixo[2 * b], abaixo[2 * b + 1]) : abaixo[2 * b];
+        }
+        g->niveis[l] = nivel;
+        g->tamanho_nivel[l] = n_nivel;
+    }
+}
+
+// Libera o estado quando a área de desenho é destruída
+static void on_gantt_destroy(GtkWidget *area, gpointer user_data) {
+    Gantt *g = user_data;
+    for (int l = 0; l < g->n_niveis; l++) {
+        g_free(g->niveis[l]);
+    }
+    g_free(g->niveis);
+    g_free(g->tamanho_nivel);
+    g_free(g->intervalos);
+    g_free(g->inicio_cpu);
+    g_free(g->pids);
+    g_free(g);
+}
+
+// Mantém a visão dentro da linha do tempo e com a escala entre os limites
+static void limitar_visao(Gantt *g, int largura) {
+    double maximo = (double)g->fim_total / largura;     // Linha do tempo inteira visível
+    double minimo = 1.0 / PIXELS_POR_UNIDADE_MAX;
+    if (maximo < minimo) {
+        maximo = minimo;
+    }
+    if (g->tempo_por_pixel <= 0 || g->tempo_por_pixel > maximo) {
+        g->tempo_por_pixel = maximo;
+    } else if (g->tempo_por_pixel < minimo) {
+        g->tempo_por_pixel = minimo;
+    }
+
+    double ultimo_inicio = g->fim_total - largura * g->tempo_por_pixel;
+    if (g->inicio_visivel > ultimo_inicio) {
+        g->inicio_visivel = ultimo_inicio;
+    }
+    if (g->inicio_visivel < 0) {
+        g->inicio_visivel = 0;
+    }
+}
+
+// Cor de um processo, derivada do PID (matizes bem espaçadas entre PIDs vizinhos)
+static void definir_cor_processo(cairo_t *cr, int pid) {
+    double matiz = fmod(pid * 0.618033988749895, 1.0);
+    double r, g, b;
+    if (matiz < 0) {
+        matiz += 1.0;
+    }
+    gtk_hsv_to_rgb(matiz, 0.55, 0.85, &r, &g, &b);
+    cairo_set_source_rgb(cr, r, g, b);
+}
+
+// Desenha a coluna de pixels `px` com a faixa de processos dos baldes do nível informado
+static void desenhar_coluna(const Gantt *g, cairo_t *cr, int nivel, int px, double altura_linha) {
+    const FaixaLinhas *baldes = g->niveis[nivel];
+    int n_baldes = g->tamanho_nivel[nivel];
+    double tamanho_balde = (double)(g->balde_base << nivel);
+
+    double ta = g->inicio_visivel + px * g->tempo_por_pixel;
+    double tb = ta + g->tempo_por_pixel;
+    if (tb <= 0 || ta >= g->fim_total) {
+        return;
+    }
+
+    long long ba = (long long)(ta > 0 ? ta / tamanho_balde : 0);
+    long long bb = (long long)ceil(tb / tamanho_balde) - 1;
+    if (bb >= n_baldes) {
+        bb = n_baldes - 1;
+    }
+
+    FaixaLinhas faixa = { -1, -1 };
+    for (long long b = ba; b <= bb; b++) {
+        faixa = unir_faixas(faixa, baldes[b]);
+    }
+    if (faixa.min < 0) {
+        return;                     // CPU ociosa nesta coluna
+    }
+
+    // Um único processo na coluna mantém sua cor; vários ficam em cinza
+    if (faixa.min == faixa.max) {
+        definir_cor_processo(cr, g->pids[faixa.min]);
+    } else {
+        cairo_set_source_rgb(cr, 0.45, 0.45, 0.5);
+    }
+    double y = faixa.min * altura_linha;
+    double h = (faixa.max - faixa.min + 1) * altura_linha;
+    cairo_rectangle(cr, MARGEM_ESQUERDA + px, y, 1, h > 1 ? h : 1);
+    cairo_fill(cr);
+}
+
+// Busca binária pelo primeiro intervalo de [esq, dir) que termina depois de `t`
+// (os intervalos de uma mesma CPU estão ordenados também pelo fim)
+static int primeiro_terminado_apos(const Gantt *g, int esq, int dir, double t) {
+    while (esq < dir) {
+        int meio = esq + (dir - esq) / 2;
+        if (g->intervalos[meio].fim <= t) {
+            esq = meio + 1;
+        } else {
+            dir = meio;
+        }
+    }
+    return esq;
+}
+
+// Desenha os intervalos visíveis (usado quando um pixel é menor que um balde)
+// Cada CPU desenha no máximo um retângulo por coluna de pixels: os intervalos
+// que terminam na mesma coluna que o anterior são resumidos pelo nível 0
+static void desenhar_intervalos(const Gantt *g, cairo_t *cr, int largura, double altura_linha) {
+    double t0 = g->inicio_visivel;
+    double t1 = t0 + largura * g->tempo_por_pixel;
+    char *resumida = g_new0(char, largura);     // Colunas a desenhar com o nível 0
+
+    for (int cpu = 0; cpu < g->n_cpus; cpu++) {
+        int fim_cpu = g->inicio_cpu[cpu + 1];
+        int k = primeiro_terminado_apos(g, g->inicio_cpu[cpu], fim_cpu, t0);
+
+        while (k < fim_cpu && g->intervalos[k].inicio < t1) {
+            const Intervalo *it = &g->intervalos[k];
+            double x = MARGEM_ESQUERDA + (it->inicio - t0) / g->tempo_por_pixel;
+            double w = (it->fim - it->inicio) / g->tempo_por_pixel;
+            definir_cor_processo(cr, g->pids[it->indice]);
+            cairo_rectangle(cr, x, it->indice * altura_linha, w, altura_linha > 1 ? altura_linha : 1);
+            cairo_fill(cr);
+
+            // Os seguintes que terminam nesta mesma coluna cabem inteiros nela
+            double coluna = floor((it->fim - t0) / g->tempo_por_pixel);
+            double fim_coluna = t0 + (coluna + 1) * g->tempo_por_pixel;
+            if (k + 1 < fim_cpu && g->intervalos[k + 1].fim <= fim_coluna) {
+                if (coluna < largura) {
+                    resumida[(int)coluna] = 1;
+                }
+                k = primeiro_terminado_apos(g, k + 1, fim_cpu, fim_coluna);
+            } else {
+                k++;
+            }
+        }
+    }
+
+    for (int px = 0; px < largura; px++) {
+        if (resumida[px]) {
+            desenhar_coluna(g, cr, 0, px, altura_linha);
+        }
+    }
+    g_free(resumida);
+}
+
+// Desenha uma coluna por pixel com a faixa de processos que executaram nela
+static void desenhar_agregado(const Gantt *g, cairo_t *cr, int largura, double altura_linha) {
+    // Nível mais detalhado cujo balde ainda cobre pelo menos um pixel
+    int nivel = 0;
+    while (nivel + 1 < g->n_niveis && (double)(g->balde_base << (nivel + 1)) <= g->tempo_por_pixel) {
+        nivel++;
+    }
+    for (int px = 0; px < largura; px++) {
+        desenhar_coluna(g, cr, nivel, px, altura_linha);
+    }
+}
+
+// Desenha o eixo de tempo com marcas em passos "redondos" (1, 2 ou 5 x 10^k)
+static void desenhar_eixo(const Gantt *g, cairo_t *cr, int largura, int altura_grafico) {
+    double bruto = ESPACO_MINIMO_MARCAS * g->tempo_por_pixel;
+    double potencia = pow(10, floor(log10(bruto > 1 ? bruto : 1)));
+    double passo = potencia;
+    if (passo < bruto) passo = 2 * potencia;
+    if (passo < bruto) passo = 5 * potencia;
+    if (passo < bruto) passo = 10 * potencia;
+
+    cairo_set_source_rgb(cr, 0.2, 0.2, 0.2);
+    cairo_set_line_width(cr, 1);
+    cairo_move_to(cr, MARGEM_ESQUERDA, altura_grafico + 0.5);
+    cairo_line_to(cr, MARGEM_ESQUERDA + largura, altura_grafico + 0.5);
+    cairo_stroke(cr);
+
+    cairo_set_font_size(cr, 10);
+    double t1 = g->inicio_visivel + largura * g->tempo_por_pixel;
+    for (double t = ceil(g->inicio_visivel / passo) * passo; t <= t1; t += passo) {
+        double x = floor(MARGEM_ESQUERDA + (t - g->inicio_visivel) / g->tempo_por_pixel) + 0.5;
+        char rotulo[32];
+        snprintf(rotulo, sizeof(rotulo), "%.0f", t);
+        cairo_move_to(cr, x, altura_grafico);
+        cairo_line_to(cr, x, altura_grafico + 5);
+        cairo_stroke(cr);
+        cairo_move_to(cr, x + 2, altura_grafico + 16);
+        cairo_show_text(cr, rotulo);
+    }
+}
+
+// Desenha os PIDs à esquerda quando as linhas são altas o bastante
+static void desenhar_rotulos(const Gantt *g, cairo_t *cr, double altura_linha) {
+    if (altura_linha < ALTURA_MINIMA_ROTULO) {
+        return;
+    }
+    cairo_set_source_rgb(cr, 0.1, 0.1, 0.1);
+    cairo_set_font_size(cr, altura_linha < 20 ? altura_linha - 2 : 12);
+    for (int i = 0; i < g->n; i++) {
+        char rotulo[24];
+        snprintf(rotulo, sizeof(rotulo), "PID %d", g->pids[i]);
+        cairo_move_to(cr, 4, i * altura_linha + altura_linha * 0.5 + 4);
+        cairo_show_text(cr, rotulo);
+    }
+}
+
+static gboolean on_gantt_draw(GtkWidget *area, cairo_t *cr, gpointer user_data) {
+    Gantt *g = user_data;
+    int largura = gtk_widget_get_allocated_width(area) - MARGEM_ESQUERDA;
+    int altura = gtk_widget_get_allocated_height(area) - MARGEM_INFERIOR;
+
+    cairo_set_source_rgb(cr, 1, 1, 1);
+    cairo_paint(cr);
+    if (largura <= 0 || altura <= 0 || g->n == 0) {
+        return FALSE;
+    }
+
+    limitar_visao(g, largura);
+    double altura_linha = (double)altura / g->n;
+
+    // Os retângulos ficam restritos à área do gráfico
+    cairo_save(cr);
+    cairo_rectangle(cr, MARGEM_ESQUERDA, 0, largura, altura);
+    cairo_clip(cr);
+    if (g->tempo_por_pixel < g->balde_base) {
+        desenhar_intervalos(g, cr, largura, altura_linha);
+    } else {
+        desenhar_agregado(g, cr, largura, altura_linha);
+    }
+    cairo_restore(cr);
+
+    desenhar_rotulos(g, cr, altura_linha);
+    desenhar_eixo(g, cr, largura, altura);
+    return FALSE;
+}
+
+// Roda do mouse: amplia ou reduz mantendo fixo o instante sob o cursor
+static gboolean on_gantt_scroll(GtkWidget *area, GdkEventScroll *evento, gpointer user_data) {
+    Gantt *g = user_data;
+    double fator;
+
+    if (evento->direction == GDK_SCROLL_UP) {
+        fator = 0.8;
+    } else if (evento->direction == GDK_SCROLL_DOWN) {
+        fator = 1.25;
+    } else if (evento->direction == GDK_SCROLL_SMOOTH) {
+        fator = pow(1.25, evento->delta_y);
+    } else {
+        return FALSE;
+    }
+
+    double x = evento->x - MARGEM_ESQUERDA;
+    double t_cursor = g->inicio_visivel + x * g->tempo_por_pixel;
+    g->tempo_por_pixel *= fator;
+    limitar_visao(g, gtk_widget_get_allocated_width(area) - MARGEM_ESQUERDA);
+    g->inicio_visivel = t_cursor - x * g->tempo_por_pixel;
+
+    gtk_widget_queue_draw(area);
+    return TRUE;
+}
+
+// Botão esquerdo inicia o arrasto; clique duplo volta a mostrar a linha do tempo inteira
+static gboolean on_gantt_press(GtkWidget *area, GdkEventButton *evento, gpointer user_data) {
+    Gantt *g = user_data;
+    if (evento->button != 1) {
+        return FALSE;
+    }
+    if (evento->type == GDK_2BUTTON_PRESS) {
+        g->tempo_por_pixel = 0;
+        g->inicio_visivel = 0;
+        gtk_widget_queue_draw(area);
+        return TRUE;
+    }
+    g->arrastando = 1;
+    g->arrasto_x = evento->x;
+    g->arrasto_inicio = g->inicio_visivel;
+    return TRUE;
+}
+
+static gboolean on_gantt_release(GtkWidget *area, GdkEventButton *evento, gpointer user_data) {
+    Gantt *g = user_data;
+    if (evento->button == 1) {
+        g->arrastando = 0;
+    }
+    return TRUE;
+}
+
+static gboolean on_gantt_motion(GtkWidget *area, GdkEventMotion *evento, gpointer user_data) {
+    Gantt *g = user_data;
+    if (!g->arrastando) {
+        return FALSE;
+    }
+    g->inicio_visivel = g->arrasto_inicio - (evento->x - g->arrasto_x) * g->tempo_por_pixel;
+    gtk_widget_queue_draw(area);
+    return TRUE;
+}
+
+// Ordena intervalos por CPU e pelo início (com várias CPUs, eles são registrados ao terminar)
+static int comparar_cpu_inicio(const void *a, const void *b) {
+    const Intervalo *x = a, *y = b;
+    if (x->cpu != y->cpu) {
+        return (x->cpu > y->cpu) - (x->cpu < y->cpu);
+    }
+    return (x->inicio > y->inicio) - (x->inicio < y->inicio);
+}
+
+GtkWidget* gantt_novo(const ResultadoSimulacao *res) {
+    Gantt *g = g_new0(Gantt, 1);
+
+    // Copia apenas o necessário para desenhar
+    g->n = res->n;
+    g->pids = g_new(int, res->n > 0 ? res->n : 1);
+    for (int i = 0; i < res->n; i++) {
+        g->pids[i] = res->metricas[i].pid;
+    }
+    g->n_intervalos = res->n_intervalos;
+    g->intervalos = g_new(Intervalo, res->n_intervalos > 0 ? res->n_intervalos : 1);
+    memcpy(g->intervalos, res->intervalos, (size_t)res->n_intervalos * sizeof(Intervalo));
+
+    int ordenado = 1;
+    for (int k = 0; k < g->n_intervalos; k++) {
+        const Intervalo *it = &g->intervalos[k];
+        if (it->fim > g->fim_total) {
+            g->fim_total = it->fim;
+        }
+        if (it->cpu >= g->n_cpus) {
+            g->n_cpus = it->cpu + 1;
+        }
+        if (k > 0 && comparar_cpu_inicio(&g->intervalos[k - 1], it) > 0) {
+            ordenado = 0;
+        }
+    }
+    if (!ordenado) {
+        qsort(g->intervalos, g->n_intervalos, sizeof(Intervalo), comparar_cpu_inicio);
+    }
+
+    // Onde começam os intervalos de cada CPU
+    g->inicio_cpu = g_new0(int, g->n_cpus + 1);
+    for (int k = 0; k < g->n_intervalos; k++) {
+        g->inicio_cpu[g->intervalos[k].cpu + 1]++;
+    }
+    for (int c = 0; c < g->n_cpus; c++) {
+        g->inicio_cpu[c + 1] += g->inicio_cpu[c];
+    }
+
+    construir_piramide(g);
+
+    GtkWidget *area = gtk_drawing_area_new();
+    gtk_widget_set_size_request(area, 400, 200);
+    gtk_widget_add_events(area, GDK_SCROLL_MASK | GDK_SMOOTH_SCROLL_MASK | GDK_BUTTON_PRESS_MASK |
+                                GDK_BUTTON_RELEASE_MASK | GDK_POINTER_MOTION_MASK);
+    g_signal_connect(area, "draw", G_CALLBACK(on_gantt_draw), g);
+    g_signal_connect(area, "scroll-event", G_CALLBACK(on_gantt_scroll), g);
+    g_signal_connect(area, "button-press-event", G_CALLBACK(on_gantt_press), g);
+    g_signal_connect(area, "button-release-event", G_CALLBACK(on_gantt_release), g);
+    g_signal_connect(area, "motion-notify-event", G_CALLBACK(on_gantt_motion), g);
+    g_signal_connect(area, "destroy", G_CALLBACK(on_gantt_destroy), g);
+    return area;
+}
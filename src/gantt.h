@@ -0,0 +1,21 @@
+/**
+ * @file gantt.h
+ * @brief Gráfico de Gantt (cairo) dos intervalos de execução de uma simulação.
+ *
+ * O gráfico pode ser ampliado com a roda do mouse e arrastado com o botão
+ * esquerdo. Intervalos menores que um pixel são agregados por coluna de
+ * pixels, então o custo de redesenho depende da largura visível e não do
+ * tamanho da linha do tempo.
+ */
+
+#ifndef GANTT_H               // Evita inclusão duplicada
+#define GANTT_H
+
+#include <gtk/gtk.h>
+#include "resultado.h"        // Intervalos de execução
+
+// Cria a área de desenho com o Gantt do resultado informado
+// Os dados necessários são copiados: o resultado pode ser liberado em seguida
+GtkWidget* gantt_novo(const ResultadoSimulacao *res);
+
+#endif
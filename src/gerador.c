@@ -0,0 +1,151 @@
+/**
+ * @file gerador.c
+ * @brief Implementação dos geradores de carga sintética.
+ *
+ * Usa o gerador splitmix64, que é rápido, tem boa qualidade estatística e
+ * não depende de rand(), então os resultados são iguais em qualquer sistema.
+ */
+
+#include <string.h>     // strcmp
+#include <math.h>       // log, expm1, pow
+#include <limits.h>     // INT_MAX
+#include "gerador.h"
+
+// Intervalo médio entre chegadas das cargas de Poisson (execução média ~10: CPU ~90% ocupada)
+#define INTERVALO_MEDIO_POISSON 11.0
+
+// Parâmetros da distribuição de Pareto: média = alfa * minimo / (alfa - 1) = 9
+#define ALFA_PARETO 1.5
+#define MINIMO_PARETO 3.0
+#define MAXIMO_PARETO 1000000   // Limita a cauda para manter os tempos em int
+
+// Distância entre chegadas da carga esparsa (maior que qualquer execução)
+#define INTERVALO_ESPARSO 100
+
+static const char *nomes_cargas[N_TIPOS_CARGA] = { "uniforme", "poisson", "pareto", "simultanea", "esparsa" };
+
+// Próximo número do splitmix64
+static unsigned long long proximo_aleatorio(unsigned long long *estado) {
+    unsigned long long z = (*estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Inteiro uniforme em [0, limite)
+static int uniforme(unsigned long long *estado, int limite) {
+    return (int)(proximo_aleatorio(estado) % (unsigned long long)limite);
+}
+
+// Real uniforme em (0, 1]
+static double uniforme_real(unsigned long long *estado) {
+    return ((proximo_aleatorio(estado) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+// Limite das chegadas uniformes
+static int limite_uniforme(int n) {
+    return n < 200000000 ? 10 * n : 2000000000;
+}
+
+void gerador_inicializar(GeradorCarga *gerador, TipoCarga tipo, int n, unsigned long long semente) {
+    gerador->tipo = tipo;
+    gerador->n = n;
+    gerador->gerados = 0;
+    gerador->estado = semente;
+    gerador->chegada = 0;
+    gerador->fracao = 0.0;
+}
+
+int gerador_proximo(GeradorCarga *gerador, Processo *p) {
+    if (gerador->gerados >= gerador->n) {
+        return 0;
+    }
+    unsigned long long *estado = &gerador->estado;
+    int i = gerador->gerados++;
+    p->pid = i + 1;
+    p->prioridade = uniforme(estado, 10);
+    p->tempo_execucao = 1 + uniforme(estado, 19);
+
+    switch (gerador->tipo) {
+        case CARGA_UNIFORME: {
+            // Chegadas uniformes já em ordem, sem sortear todas e ordenar: o menor
+            // de k uniformes em (f, 1) é f + (1 - f)(1 - V^(1/k)), com V uniforme
+            int restantes = gerador->n - i;
+            gerador->fracao += (1.0 - gerador->fracao) * -expm1(log(uniforme_real(estado)) / restantes);
+            int limite = limite_uniforme(gerador->n);
+            int chegada = (int)(gerador->fracao * limite);
+            p->tempo_chegada = chegada < limite ? chegada : limite - 1;
+            break;
+        }
+        case CARGA_POISSON:
+            if (gerador->chegada > INT_MAX) {
+                return -1;
+            }
+            p->tempo_chegada = (int)gerador->chegada;
+            gerador->chegada += (int)(-log(uniforme_real(estado)) * INTERVALO_MEDIO_POISSON + 0.5);
+            break;
+        case CARGA_PARETO: {
+            if (gerador->chegada > INT_MAX) {
+                return -1;
+            }
+            p->tempo_chegada = (int)gerador->chegada;
+            gerador->chegada += (int)(-log(uniforme_real(estado)) * INTERVALO_MEDIO_POISSON + 0.5);
+            double execucao = MINIMO_PARETO / pow(uniforme_real(estado), 1.0 / ALFA_PARETO);
+            p->tempo_execucao = execucao < MAXIMO_PARETO ? (int)execucao : MAXIMO_PARETO;
+            break;
+        }
+        case CARGA_SIMULTANEA:
+            p->tempo_chegada = 0;
+            break;
+        case CARGA_ESPARSA:
+            if (i > INT_MAX / INTERVALO_ESPARSO) {
+                return -1;
+            }
+            p->tempo_chegada = i * INTERVALO_ESPARSO;
+            break;
+        default:
+            p->tempo_chegada = 0;
+            break;
+    }
+    return 1;
+}
+
+int maximo_processos_carga(TipoCarga tipo) {
+    switch (tipo) {
+        case CARGA_POISSON:
+        case CARGA_PARETO:
+            return (int)(INT_MAX / INTERVALO_MEDIO_POISSON);
+        case CARGA_ESPARSA:
+            return INT_MAX / INTERVALO_ESPARSO + 1;
+        default:
+            return INT_MAX;
+    }
+}
+
+int gerar_carga(TipoCarga tipo, int n, unsigned long long semente, Processo *processos) {
+    GeradorCarga gerador;
+    gerador_inicializar(&gerador, tipo, n, semente);
+    for (int i = 0; i < n; i++) {
+        if (gerador_proximo(&gerador, &processos[i]) < 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+const char* nome_tipo_carga(TipoCarga tipo) {
+    if (tipo < 0 || tipo >= N_TIPOS_CARGA) {
+        return "?";
+    }
+    return nomes_cargas[tipo];
+}
+
+int tipo_carga_por_nome(const char *nome, TipoCarga *tipo) {
+    for (int i = 0; i < N_TIPOS_CARGA; i++) {
+        if (strcmp(nome, nomes_cargas[i]) == 0) {
+            *tipo = (TipoCarga)i;
+            return 1;
+        }
+    }
+    return 0;
+}
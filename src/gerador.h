@@ -0,0 +1,58 @@
+/**
+ * @file gerador.h
+ * @brief Geração de cargas de trabalho sintéticas e reproduzíveis.
+ *
+ * Cada tipo de carga gera n processos a partir de uma semente: a mesma
+ * semente sempre produz a mesma lista. Os processos saem em ordem de
+ * (chegada, PID), com PIDs 1..n, então a ordem de chegada é a identidade.
+ * O gerador incremental produz a mesma carga um processo por vez, sem
+ * guardar a lista, para a simulação em fluxo.
+ */
+
+#ifndef GERADOR_H             // Evita inclusão duplicada
+#define GERADOR_H
+
+#include "processos.h"        // Definição da struct Processo
+
+// Tipos de carga disponíveis
+typedef enum {
+    CARGA_UNIFORME,           // Chegadas uniformes em [0, 10n), execução uniforme de 1 a 19
+    CARGA_POISSON,            // Chegadas de Poisson (intervalo médio 11), execução uniforme de 1 a 19
+    CARGA_PARETO,             // Chegadas de Poisson, execução de cauda pesada (Pareto, alfa 1,5, média 9)
+    CARGA_SIMULTANEA,         // Todos chegam no instante 0, execução uniforme de 1 a 19
+    CARGA_ESPARSA,            // Chegadas separadas por 100 unidades (CPU quase sempre ociosa)
+    N_TIPOS_CARGA             // Quantidade de tipos (não é um tipo)
+} TipoCarga;
+
+// Estado do gerador incremental
+typedef struct {
+    TipoCarga tipo;
+    int n;                    // Processos a gerar
+    int gerados;              // Processos já gerados
+    unsigned long long estado; // Estado do sorteio
+    long long chegada;        // Próxima chegada (Poisson e Pareto), que pode passar de INT_MAX
+    double fracao;            // Última chegada uniforme, como fração do intervalo [0, 10n)
+} GeradorCarga;
+
+// Maior n aceito para o tipo de carga: acima dele a última chegada (a esperada,
+// nas cargas de Poisson e Pareto) passaria de INT_MAX
+int maximo_processos_carga(TipoCarga tipo);
+
+// Preenche `processos` (n posições) com uma carga do tipo indicado
+// Prioridades são uniformes de 0 a 9. Retorna 0 se alguma chegada passar de INT_MAX
+int gerar_carga(TipoCarga tipo, int n, unsigned long long semente, Processo *processos);
+
+// Prepara o gerador para os mesmos n processos de gerar_carga(tipo, n, semente, ...)
+void gerador_inicializar(GeradorCarga *gerador, TipoCarga tipo, int n, unsigned long long semente);
+
+// Gera o próximo processo, em ordem de chegada; retorna 0 depois do n-ésimo
+// e -1 se a chegada passar de INT_MAX
+int gerador_proximo(GeradorCarga *gerador, Processo *p);
+
+// Retorna o nome curto do tipo ("uniforme", "poisson", "pareto", "simultanea", "esparsa")
+const char* nome_tipo_carga(TipoCarga tipo);
+
+// Converte um nome curto em tipo de carga; retorna 0 se o nome for desconhecido
+int tipo_carga_por_nome(const char *nome, TipoCarga *tipo);
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * @file histograma.c
+ * @brief Implementação do histograma log-linear de memória fixa.
+ *
+ * Um valor v < 256 vai para o balde v. Acima disso, com d = (bit mais alto
+ * de v) - 7, v vai para o balde ((d + 1) << 7) + (v >> d) - 128: os 8 bits
+ * mais altos de v escolhem o balde e os d bits de baixo são descartados.
+ */
+
+#include <stdlib.h>     // calloc, free
+#include <string.h>     // memset, memcpy
+#include <assert.h>     // assert
+#include "histograma.h"
+
+#define SUB (1 << HISTOGRAMA_BITS_SUB)
+
+// Balde do valor v (v >= 0)
+static int balde_de(int v) {
+    if (v < 2 * SUB) {
+        return v;
+    }
+    int deslocamento = (31 - __builtin_clz((unsigned)v)) - HISTOGRAMA_BITS_SUB;
+    return ((deslocamento + 1) << HISTOGRAMA_BITS_SUB) + (v >> deslocamento) - SUB;
+}
+
+// Maior valor que cai no balde b
+static long long maior_valor_do_balde(int b) {
+    if (b < 2 * SUB) {
+        return b;
+    }
+    int deslocamento = (b >> HISTOGRAMA_BITS_SUB) - 1;
+    long long base = (long long)((b & (SUB - 1)) + SUB) << deslocamento;
+    return base + (1LL << deslocamento) - 1;
+}
+
+void histograma_inicializar(Histograma *h) {
+    h->contagem = NULL;
+    h->total = 0;
+    h->soma = 0;
+    h->minimo = 0;
+    h->maximo = 0;
+}
+
+void histograma_limpar(Histograma *h) {
+    if (h->contagem == NULL) {
+        h->contagem = calloc(HISTOGRAMA_BALDES, sizeof(long long));
+        if (h->contagem == NULL) {
+            abort();            // Sem memória não há como continuar a simulação
+        }
+    } else {
+        memset(h->contagem, 0, HISTOGRAMA_BALDES * sizeof(long long));
+    }
+    h->total = 0;
+    h->soma = 0;
+    h->minimo = 0;
+    h->maximo = 0;
+}
+
+void histograma_copiar(Histograma *destino, const Histograma *origem) {
+    if (destino->contagem == NULL) {
+        histograma_limpar(destino);
+    }
+    if (origem->contagem != NULL) {
+        memcpy(destino->contagem, origem->contagem, HISTOGRAMA_BALDES * sizeof(long long));
+    } else {
+        memset(destino->contagem, 0, HISTOGRAMA_BALDES * sizeof(long long));
+    }
+    destino->total = origem->total;
+    destino->soma = origem->soma;
+    destino->minimo = origem->minimo;
+    destino->maximo = origem->maximo;
+}
+
+void histograma_registrar(Histograma *h, int valor) {
+    assert(valor >= 0);         // Tempos negativos são barrados na leitura da carga
+    if (h->total == 0 || valor < h->minimo) {
+        h->minimo = valor;
+    }
+    if (valor > h->maximo) {
+        h->maximo = valor;
+    }
+    h->contagem[balde_de(valor)]++;
+    h->total++;
+    h->soma += valor;
+}
+
+double histograma_media(const Histograma *h) {
+    return h->total > 0 ? (double)h->soma / h->total : 0.0;
+}
+
+int histograma_percentil(const Histograma *h, double percentil) {
+    if (h->total == 0) {
+        return 0;
+    }
+
+    // Posição (1 a total) do valor procurado na ordem crescente, arredondada para cima
+    double alvo = percentil / 100.0 * h->total;
+    long long posicao = (long long)alvo;
+    if (posicao < alvo) {
+        posicao++;
+    }
+    if (posicao < 1) {
+        posicao = 1;
+    }
+    if (posicao >= h->total) {
+        return h->maximo;
+    }
+
+    long long acumulado = 0;
+    for (int b = 0; b < HISTOGRAMA_BALDES; b++) {
+        acumulado += h->contagem[b];
+        if (acumulado >= posicao) {
+            long long v = maior_valor_do_balde(b);
+            if (v > h->maximo) v = h->maximo;
+            if (v < h->minimo) v = h->minimo;
+            return (int)v;
+        }
+    }
+    return h->maximo;
+}
+
+void histograma_liberar(Histograma *h) {
+    free(h->contagem);
+    histograma_inicializar(h);
+}
@@ -0,0 +1,52 @@
+/**
+ * @file histograma.h
+ * @brief Histograma de memória fixa para percentis de tempos da simulação.
+ *
+ * Segue a ideia do HdrHistogram: valores até 255 têm um balde cada; acima
+ * disso, cada potência de 2 é dividida em 128 baldes, então o erro relativo
+ * de um percentil é menor que 1%. Registrar um valor é O(1) e a memória não
+ * depende da quantidade de valores, então resumir milhões de processos não
+ * exige guardar nem ordenar os valores.
+ */
+
+#ifndef HISTOGRAMA_H          // Evita inclusão duplicada
+#define HISTOGRAMA_H
+
+// Bits de subdivisão de cada potência de 2 (2^7 = 128 baldes)
+#define HISTOGRAMA_BITS_SUB 7
+
+// Quantidade de baldes para cobrir todos os valores int não negativos
+#define HISTOGRAMA_BALDES ((32 - HISTOGRAMA_BITS_SUB) << HISTOGRAMA_BITS_SUB)
+
+// Histograma de valores int não negativos
+typedef struct {
+    long long *contagem;      // HISTOGRAMA_BALDES contadores (NULL até o primeiro histograma_limpar)
+    long long total;          // Quantidade de valores registrados
+    long long soma;           // Soma exata dos valores, para a média
+    int minimo;               // Menor valor registrado
+    int maximo;               // Maior valor registrado
+} Histograma;
+
+// Inicializa um histograma vazio, sem alocar memória
+void histograma_inicializar(Histograma *h);
+
+// Esvazia o histograma, alocando os baldes na primeira vez
+void histograma_limpar(Histograma *h);
+
+// Torna `destino` uma cópia de `origem`, alocando os baldes se preciso
+void histograma_copiar(Histograma *destino, const Histograma *origem);
+
+// Registra um valor, que não pode ser negativo - O(1)
+void histograma_registrar(Histograma *h, int valor);
+
+// Média exata dos valores registrados (0 se vazio)
+double histograma_media(const Histograma *h);
+
+// Valor abaixo do qual estão `percentil`% dos valores (0 a 100), com erro
+// relativo menor que 1%; o percentil 100 é o máximo exato - O(baldes)
+int histograma_percentil(const Histograma *h, double percentil);
+
+// Libera a memória do histograma
+void histograma_liberar(Histograma *h);
+
+#endif
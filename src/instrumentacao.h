@@ -0,0 +1,79 @@
+/**
+ * @file instrumentacao.h
+ * @brief Contadores e cronômetros internos do simulador.
+ *
+ * Os macros INSTR_* marcam pontos do laço dos algoritmos (decisões,
+ * preempções, saltos de ociosidade, tamanho da fila de prontos) e medem o
+ * tempo de relógio de cada fase. Só fazem algo quando o programa é compilado
+ * com ESCALONADOR_INSTRUMENTACAO definido (make INSTRUMENTACAO=1); caso
+ * contrário viram ((void)0) e o laço fica igual ao original.
+ */
+
+#ifndef INSTRUMENTACAO_H      // Evita inclusão duplicada
+#define INSTRUMENTACAO_H
+
+// Fases cronometradas de uma execução
+typedef enum {
+    FASE_PREPARACAO,          // resultado_preparar: métricas iniciais e histogramas
+    FASE_SIMULACAO,           // Laço principal do algoritmo
+    FASE_FORMATACAO,          // Texto/CSV do resultado (medida por quem formata)
+    N_FASES
+} FaseSimulacao;
+
+// Dados coletados em uma execução (zerados por resultado_preparar)
+typedef struct {
+    int ativa;                          // 1 se o programa foi compilado com a instrumentação
+    long long decisoes;                 // Vezes em que o escalonador escolheu o próximo processo
+    long long preempcoes;               // Processos devolvidos à fila e trocados por outro na decisão seguinte
+    long long saltos_ociosos;           // Saltos do relógio até a próxima chegada com a CPU ociosa
+    int max_prontos;                    // Maior quantidade de processos prontos em uma decisão
+    int devolvido;                      // Último processo devolvido à fila sem terminar (-1 = nenhum)
+    long long tempo_fase_ns[N_FASES];   // Tempo de relógio acumulado em cada fase
+    long long inicio_fase_ns[N_FASES];  // Início da medição em andamento de cada fase
+} Instrumentacao;
+
+#ifdef ESCALONADOR_INSTRUMENTACAO
+
+#include <time.h>             // clock_gettime
+
+static inline long long instr_agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Uma decisão: `prontos` processos disputavam a CPU e `indice` foi escolhido
+static inline void instr_decisao(Instrumentacao *in, int indice, int prontos) {
+    in->decisoes++;
+    if (prontos > in->max_prontos) {
+        in->max_prontos = prontos;
+    }
+    if (in->devolvido >= 0 && in->devolvido != indice) {
+        in->preempcoes++;
+    }
+    in->devolvido = -1;
+}
+
+#define INSTR_DECISAO(res, indice, prontos)  instr_decisao(&(res)->instr, (indice), (prontos))
+#define INSTR_DEVOLVIDO(res, indice)         ((res)->instr.devolvido = (indice))
+#define INSTR_SALTO_OCIOSO(res)              ((res)->instr.saltos_ociosos++)
+#define INSTR_PRONTOS(res, prontos)          do { if ((prontos) > (res)->instr.max_prontos) \
+                                                      (res)->instr.max_prontos = (prontos); } while (0)
+#define INSTR_INICIAR_FASE(res, fase)        ((res)->instr.inicio_fase_ns[fase] = instr_agora_ns())
+#define INSTR_ENCERRAR_FASE(res, fase)       ((res)->instr.tempo_fase_ns[fase] += \
+                                                  instr_agora_ns() - (res)->instr.inicio_fase_ns[fase])
+#define INSTR_ATIVA 1
+
+#else
+
+#define INSTR_DECISAO(res, indice, prontos)  ((void)0)
+#define INSTR_DEVOLVIDO(res, indice)         ((void)0)
+#define INSTR_SALTO_OCIOSO(res)              ((void)0)
+#define INSTR_PRONTOS(res, prontos)          ((void)0)
+#define INSTR_INICIAR_FASE(res, fase)        ((void)0)
+#define INSTR_ENCERRAR_FASE(res, fase)       ((void)0)
+#define INSTR_ATIVA 0
+
+#endif
+
+#endif
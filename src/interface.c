@@ -9,29 +9,55 @@
  * A interface possui:
  *  - Janela para visualização e controle da lista de processos
  *  - Diálogo para adicionar processos
+ *  - Carregamento e gravação da lista em arquivo (CSV ou binário)
  *  - Seleção de algoritmo
  *  - Exibição do resultado da simulação
+ *  - Reaproveitamento da última simulação depois de editar a lista
  *
  * @author Carolina Mafra Sada, Amanda Victória Almeida Silva
  */
 #include <gtk/gtk.h>                  // Biblioteca GTK para construção da interface gráfica
 #include <stdlib.h>                  // Biblioteca padrão para alocação de memória e conversões
+#include <string.h>                  // memcpy para copiar a lista antes de simular
 #include "processos.h"               // Header com estrutura e funções de manipulação de processos
 #include "simulador.h"               // Header com os algoritmos de escalonamento
+#include "multicpu.h"                // Simulação com várias CPUs
+#include "relatorio.h"               // Formatação do resultado em texto
+#include "carga.h"                   // Leitura e gravação de cargas de trabalho em arquivo
+#include "gantt.h"                   // Gráfico de Gantt do resultado
+#include "retomada.h"                // Pontos de retomada da simulação
 
 // Variáveis externas (definidas em outro arquivo)
-extern Processo *lista_processos;    // Lista dinâmica de processos 
-extern int n_processos;              // Número total de processos atuais
+extern ListaProcessos lista_processos;  // Lista dinâmica de processos
+
+// Colunas do modelo da lista de processos
+enum {
+    COLUNA_PID,
+    COLUNA_CHEGADA,
+    COLUNA_EXECUCAO,
+    COLUNA_PRIORIDADE,
+    N_COLUNAS
+};
+
+// Modelo exibido na tela de processos: cada alteração da lista atualiza só a linha afetada
+static GtkListStore *modelo_processos = NULL;
+static GtkWidget *tree_processos = NULL;
+static GHashTable *linhas_por_pid = NULL;   // PID -> GtkTreeIter da linha no modelo
 
 // Protótipos
 void abrir_tela_processos();
 void abrir_dialogo_adicionar_processo(GtkWidget *parent);
-void atualizar_lista(GtkWidget *listbox);
+void atualizar_lista(void);
+void adicionar_linha_processo(const Processo *p);
+void remover_linha_processo(int pid);
 void on_btn_remover_clicked(GtkButton *button, gpointer user_data);
 void on_btn_reinicializar_clicked(GtkButton *button, gpointer user_data);
+void on_btn_carregar_clicked(GtkButton *button, gpointer user_data);
+void on_btn_salvar_clicked(GtkButton *button, gpointer user_data);
 void abrir_tela_selecao_algoritmo(GtkWidget *widget);
-void executar_escalonamento(int algoritmo_index, GtkWidget *widget);
-void abrir_resultado_simulacao(const char *resultado);
+void executar_escalonamento(int algoritmo_index, const ParametrosSimulacao *parametros,
+                            const ConfigMultiCPU *config, GtkWidget *widget);
+void abrir_resultado_simulacao(const ResultadoSimulacao *res, const BufferSaida *resultado);
 
 
 // Abre um diálogo GTK para o usuário inserir os dados de processos
@@ -95,15 +121,21 @@ void abrir_dialogo_adicionar_processo(GtkWidget *parent) {
         if (g_strcmp0(chegada_text, "") != 0 && g_strcmp0(execucao_text, "") != 0 && g_strcmp0(prioridade_text, "") != 0) {
             // Se sim, cria novo processo, insere e atualiza
             Processo novo;
-            novo.pid = n_processos + 1;
+            novo.pid = lista_processos.proximo_pid;
             novo.tempo_chegada = atoi(chegada_text);
             novo.tempo_execucao = atoi(execucao_text);
             novo.prioridade = atoi(prioridade_text);
 
-            lista_processos = inserir_processo(lista_processos, &n_processos, novo);
-
-            g_print("Processo %d adicionado.\n", novo.pid);
-            abrir_tela_processos(); // Atualiza a lista
+            if (novo.tempo_chegada < 0 || novo.tempo_execucao < 0) {
+                g_print("Chegada e execução não podem ser negativas!\n");
+            } else if (buscar_processo(&lista_processos, novo.pid) >= 0) {
+                g_print("Não há PID livre depois do PID %d!\n", novo.pid);    // O maior PID já é INT_MAX
+            } else if (inserir_processo(&lista_processos, novo)) {
+                g_print("Processo %d adicionado.\n", novo.pid);
+                adicionar_linha_processo(&novo); // Acrescenta apenas a nova linha
+            } else {
+                g_print("Não foi possível adicionar o processo.\n");
+            }
         } else {    // Caso contrário
             g_print("Preencha todos os campos!\n");
         }
@@ -112,77 +144,164 @@ void abrir_dialogo_adicionar_processo(GtkWidget *parent) {
     gtk_widget_destroy(dialog);
 }
 
-// Atualiza os itens da lista de processos
-void atualizar_lista(GtkWidget *listbox) {
-    // Limpa o conteúdo atual
-    gtk_list_box_prepend(GTK_LIST_BOX(listbox), gtk_label_new("")); 
-    GList *children, *iter;
+// Acrescenta a linha de um processo ao modelo e guarda sua posição pelo PID
+void adicionar_linha_processo(const Processo *p) {
+    GtkTreeIter iter;
+    gtk_list_store_insert_with_values(modelo_processos, &iter, -1,
+                                      COLUNA_PID, p->pid,
+                                      COLUNA_CHEGADA, p->tempo_chegada,
+                                      COLUNA_EXECUCAO, p->tempo_execucao,
+                                      COLUNA_PRIORIDADE, p->prioridade,
+                                      -1);
+
+    // Os iteradores do GtkListStore continuam válidos enquanto a linha existir
+    GtkTreeIter *copia = g_new(GtkTreeIter, 1);
+    *copia = iter;
+    g_hash_table_replace(linhas_por_pid, GINT_TO_POINTER(p->pid), copia);
+}
 
-    children = gtk_container_get_children(GTK_CONTAINER(listbox));
-    for (iter = children; iter != NULL; iter = g_list_next(iter)) {
-        gtk_widget_destroy(GTK_WIDGET(iter->data));
+// Remove a linha do processo com o PID informado, sem tocar nas demais
+void remover_linha_processo(int pid) {
+    GtkTreeIter *iter = g_hash_table_lookup(linhas_por_pid, GINT_TO_POINTER(pid));
+    if (iter != NULL) {
+        gtk_list_store_remove(modelo_processos, iter);
+        g_hash_table_remove(linhas_por_pid, GINT_TO_POINTER(pid));
     }
-    g_list_free(children);
-
-    // Cria um item por processo
-    for (int i = 0; i < n_processos; i++) {
-        char buffer[128];
-        snprintf(buffer, sizeof(buffer), "PID: %d | Chegada: %d | Execução: %d | Prioridade: %d",
-                 lista_processos[i].pid,
-                 lista_processos[i].tempo_chegada,
-                 lista_processos[i].tempo_execucao,
-                 lista_processos[i].prioridade);
-
-        GtkWidget *row = gtk_list_box_row_new();
-        GtkWidget *hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-        GtkWidget *label = gtk_label_new(buffer);
-        GtkWidget *btn_remover = gtk_button_new_with_label("Remover");
-
-        // Associar o PID ao botão para remoção
-        g_object_set_data(G_OBJECT(btn_remover), "pid", GINT_TO_POINTER(lista_processos[i].pid));
-
-        g_signal_connect(btn_remover, "clicked", G_CALLBACK(on_btn_remover_clicked), listbox);
+}
 
-        // Adiciona à interface
-        gtk_box_pack_start(GTK_BOX(hbox), label, TRUE, TRUE, 0);
-        gtk_box_pack_start(GTK_BOX(hbox), btn_remover, FALSE, FALSE, 0);
+// Reconstrói todo o modelo a partir da lista (usado só quando a lista inteira muda)
+void atualizar_lista(void) {
+    // Desconecta o modelo da visão para não redesenhar a cada linha inserida
+    g_object_ref(modelo_processos);
+    gtk_tree_view_set_model(GTK_TREE_VIEW(tree_processos), NULL);
 
-        gtk_container_add(GTK_CONTAINER(row), hbox);
-        gtk_list_box_insert(GTK_LIST_BOX(listbox), row, -1);
+    gtk_list_store_clear(modelo_processos);
+    g_hash_table_remove_all(linhas_por_pid);
+    for (int i = 0; i < lista_processos.n; i++) {
+        adicionar_linha_processo(&lista_processos.itens[i]);
     }
-    gtk_widget_show_all(listbox);
+
+    gtk_tree_view_set_model(GTK_TREE_VIEW(tree_processos), GTK_TREE_MODEL(modelo_processos));
+    g_object_unref(modelo_processos);
 }
 
-// Callback para o botão remover
+// Callback para o botão remover: remove os processos selecionados
 void on_btn_remover_clicked(GtkButton *button, gpointer user_data) {
-    int pid = GPOINTER_TO_INT(g_object_get_data(G_OBJECT(button), "pid"));
-    lista_processos = remover_processo(lista_processos, &n_processos, pid);
-
-    GtkWidget *listbox = GTK_WIDGET(user_data);
-    atualizar_lista(listbox);
+    GtkTreeSelection *selecao = gtk_tree_view_get_selection(GTK_TREE_VIEW(user_data));
+    GtkTreeModel *modelo;
+    GList *linhas = gtk_tree_selection_get_selected_rows(selecao, &modelo);
+    GArray *pids = g_array_new(FALSE, FALSE, sizeof(int));
+
+    // Primeiro coleta os PIDs: remover linhas invalida os caminhos restantes
+    for (GList *it = linhas; it != NULL; it = g_list_next(it)) {
+        GtkTreeIter iter;
+        int pid;
+        if (gtk_tree_model_get_iter(modelo, &iter, (GtkTreePath *)it->data)) {
+            gtk_tree_model_get(modelo, &iter, COLUNA_PID, &pid, -1);
+            g_array_append_val(pids, pid);
+        }
+    }
+    g_list_free_full(linhas, (GDestroyNotify)gtk_tree_path_free);
 
-    g_print("Processo %d removido.\n", pid);
+    for (guint i = 0; i < pids->len; i++) {
+        int pid = g_array_index(pids, int, i);
+        if (remover_processo(&lista_processos, pid)) {
+            remover_linha_processo(pid);
+            g_print("Processo %d removido.\n", pid);
+        }
+    }
+    g_array_free(pids, TRUE);
 }
 
 // Callback para reinicializar lista
 void on_btn_reinicializar_clicked(GtkButton *button, gpointer user_data) {
-    reinicializar_lista(&lista_processos, &n_processos);
+    reinicializar_lista(&lista_processos);
 
-    GtkWidget *listbox = GTK_WIDGET(user_data);
-    atualizar_lista(listbox);
+    gtk_list_store_clear(modelo_processos);
+    g_hash_table_remove_all(linhas_por_pid);
 
     g_print("Lista reinicializada.\n");
 }
 
+// Callback para carregar uma carga de trabalho de arquivo (substitui a lista atual)
+void on_btn_carregar_clicked(GtkButton *button, gpointer user_data) {
+    GtkWidget *dialog = gtk_file_chooser_dialog_new("Carregar Processos",
+                                                    GTK_WINDOW(user_data),
+                                                    GTK_FILE_CHOOSER_ACTION_OPEN,
+                                                    "_Cancelar", GTK_RESPONSE_CANCEL,
+                                                    "_Abrir", GTK_RESPONSE_ACCEPT,
+                                                    NULL);
+
+    if (gtk_dialog_run(GTK_DIALOG(dialog)) == GTK_RESPONSE_ACCEPT) {
+        gchar *caminho = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+        Processo *nova_lista = NULL;
+        int n_novos = 0;
+        int linha_erro = 0;
+
+        StatusCarga status = carregar_carga(caminho, &nova_lista, &n_novos, &linha_erro);
+        int substituida = status == CARGA_OK ? substituir_lista(&lista_processos, nova_lista, n_novos) : 0;
+        if (status == CARGA_OK && substituida < 0) {
+            g_print("Erro ao carregar %s: %s\n", caminho, descrever_status_carga(CARGA_ERRO_MEMORIA));
+        } else if (status == CARGA_OK && substituida == 0) {
+            g_print("Erro ao carregar %s: PIDs repetidos\n", caminho);
+        } else if (status == CARGA_OK) {
+            g_print("%d processos carregados de %s.\n", n_novos, caminho);
+            atualizar_lista(); // A lista inteira mudou
+        } else if (status == CARGA_ERRO_FORMATO && linha_erro > 0) {
+            g_print("Erro ao carregar %s: %s (linha %d)\n", caminho, descrever_status_carga(status), linha_erro);
+        } else if (status == CARGA_ERRO_FORMATO && linha_erro < 0) {
+            g_print("Erro ao carregar %s: %s (registro %d)\n", caminho, descrever_status_carga(status), -linha_erro);
+        } else {
+            g_print("Erro ao carregar %s: %s\n", caminho, descrever_status_carga(status));
+        }
+        g_free(caminho);
+    }
+    gtk_widget_destroy(dialog);
+}
+
+// Callback para salvar a lista atual em arquivo (.bin = binário, senão CSV)
+void on_btn_salvar_clicked(GtkButton *button, gpointer user_data) {
+    GtkWidget *dialog = gtk_file_chooser_dialog_new("Salvar Processos",
+                                                    GTK_WINDOW(user_data),
+                                                    GTK_FILE_CHOOSER_ACTION_SAVE,
+                                                    "_Cancelar", GTK_RESPONSE_CANCEL,
+                                                    "_Salvar", GTK_RESPONSE_ACCEPT,
+                                                    NULL);
+    gtk_file_chooser_set_do_overwrite_confirmation(GTK_FILE_CHOOSER(dialog), TRUE);
+    gtk_file_chooser_set_current_name(GTK_FILE_CHOOSER(dialog), "processos.csv");
+
+    if (gtk_dialog_run(GTK_DIALOG(dialog)) == GTK_RESPONSE_ACCEPT) {
+        gchar *caminho = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+        StatusCarga status = g_str_has_suffix(caminho, ".bin")
+                                 ? salvar_carga_binaria(caminho, lista_processos.itens, lista_processos.n)
+                                 : salvar_carga_csv(caminho, lista_processos.itens, lista_processos.n);
+
+        if (status == CARGA_OK) {
+            g_print("%d processos salvos em %s.\n", lista_processos.n, caminho);
+        } else {
+            g_print("Erro ao salvar %s: %s\n", caminho, descrever_status_carga(status));
+        }
+        g_free(caminho);
+    }
+    gtk_widget_destroy(dialog);
+}
+
+// Cria uma coluna de largura fixa (necessário para o modo de altura fixa da visão)
+static void adicionar_coluna(GtkWidget *tree, const char *titulo, int coluna, int largura) {
+    GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
+    GtkTreeViewColumn *col = gtk_tree_view_column_new_with_attributes(titulo, renderer, "text", coluna, NULL);
+    gtk_tree_view_column_set_sizing(col, GTK_TREE_VIEW_COLUMN_FIXED);
+    gtk_tree_view_column_set_fixed_width(col, largura);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(tree), col);
+}
+
 // Função principal para abrir a tela de processos
 void abrir_tela_processos() {
     // Evitar abrir janelas duplicadas
     static GtkWidget *window = NULL;
-    static GtkWidget *listbox = NULL;
 
     if (window != NULL) {
         gtk_window_present(GTK_WINDOW(window));
-        atualizar_lista(listbox);
         return;
     }
 
@@ -195,19 +314,49 @@ void abrir_tela_processos() {
     gtk_container_set_border_width(GTK_CONTAINER(vbox), 10);
     gtk_container_add(GTK_CONTAINER(window), vbox);
 
-    // ListBox para os processos e botões
-    listbox = gtk_list_box_new();
-    gtk_box_pack_start(GTK_BOX(vbox), listbox, TRUE, TRUE, 0);
+    // Modelo e visão da lista: com altura fixa, só as linhas visíveis são desenhadas
+    modelo_processos = gtk_list_store_new(N_COLUNAS, G_TYPE_INT, G_TYPE_INT, G_TYPE_INT, G_TYPE_INT);
+    linhas_por_pid = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    tree_processos = gtk_tree_view_new_with_model(GTK_TREE_MODEL(modelo_processos));
+    g_object_unref(modelo_processos);   // A visão passa a ser dona do modelo
+
+    adicionar_coluna(tree_processos, "PID", COLUNA_PID, 80);
+    adicionar_coluna(tree_processos, "Chegada", COLUNA_CHEGADA, 110);
+    adicionar_coluna(tree_processos, "Execução", COLUNA_EXECUCAO, 110);
+    adicionar_coluna(tree_processos, "Prioridade", COLUNA_PRIORIDADE, 110);
+    gtk_tree_view_set_fixed_height_mode(GTK_TREE_VIEW(tree_processos), TRUE);
+    gtk_tree_selection_set_mode(gtk_tree_view_get_selection(GTK_TREE_VIEW(tree_processos)),
+                                GTK_SELECTION_MULTIPLE);
+
+    GtkWidget *scroll = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scroll), GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_container_add(GTK_CONTAINER(scroll), tree_processos);
+    gtk_box_pack_start(GTK_BOX(vbox), scroll, TRUE, TRUE, 0);
 
     // Botão adicionar
     GtkWidget *btn_add = gtk_button_new_with_label("Adicionar Processo");
     gtk_box_pack_start(GTK_BOX(vbox), btn_add, FALSE, FALSE, 0);
     g_signal_connect(btn_add, "clicked", G_CALLBACK(abrir_dialogo_adicionar_processo), window);
 
+    // Botão remover (processos selecionados na lista)
+    GtkWidget *btn_remover = gtk_button_new_with_label("Remover Selecionados");
+    gtk_box_pack_start(GTK_BOX(vbox), btn_remover, FALSE, FALSE, 0);
+    g_signal_connect(btn_remover, "clicked", G_CALLBACK(on_btn_remover_clicked), tree_processos);
+
+    // Botões para carregar e salvar a lista em arquivo
+    GtkWidget *hbox_arquivo = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    GtkWidget *btn_carregar = gtk_button_new_with_label("Carregar Arquivo");
+    GtkWidget *btn_salvar = gtk_button_new_with_label("Salvar Arquivo");
+    gtk_box_pack_start(GTK_BOX(hbox_arquivo), btn_carregar, TRUE, TRUE, 0);
+    gtk_box_pack_start(GTK_BOX(hbox_arquivo), btn_salvar, TRUE, TRUE, 0);
+    gtk_box_pack_start(GTK_BOX(vbox), hbox_arquivo, FALSE, FALSE, 0);
+    g_signal_connect(btn_carregar, "clicked", G_CALLBACK(on_btn_carregar_clicked), window);
+    g_signal_connect(btn_salvar, "clicked", G_CALLBACK(on_btn_salvar_clicked), window);
+
     // Botão reinicializar
     GtkWidget *btn_reinicializar = gtk_button_new_with_label("Reinicializar Lista");
     gtk_box_pack_start(GTK_BOX(vbox), btn_reinicializar, FALSE, FALSE, 0);
-    g_signal_connect(btn_reinicializar, "clicked", G_CALLBACK(on_btn_reinicializar_clicked), listbox);
+    g_signal_connect(btn_reinicializar, "clicked", G_CALLBACK(on_btn_reinicializar_clicked), NULL);
     
     // Botão executar escalonamento
     GtkWidget *btn_executar = gtk_button_new_with_label("Selecionar Algoritmo");
@@ -215,8 +364,8 @@ void abrir_tela_processos() {
     g_signal_connect(btn_executar, "clicked", G_CALLBACK(abrir_tela_selecao_algoritmo), window);
 
     // Mostra tudo e define callback de encerramento
+    atualizar_lista();
     gtk_widget_show_all(window);
-    atualizar_lista(listbox);
 
     g_signal_connect(window, "destroy", G_CALLBACK(gtk_main_quit), NULL);
 
@@ -239,53 +388,330 @@ void abrir_tela_selecao_algoritmo(GtkWidget *parent) {
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(combo_algoritmo), "SJF");
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(combo_algoritmo), "Round-Robin");
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(combo_algoritmo), "Prioridade (Preemptivo)");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(combo_algoritmo), "MLFQ");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(combo_algoritmo), "CFS");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(combo_algoritmo), "SRTF (SJF Preemptivo)");
 
     gtk_container_add(GTK_CONTAINER(content_area), combo_algoritmo);
 
+    // Campo para o quantum do Round-Robin
+    GtkWidget *hbox_quantum = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    GtkWidget *label_quantum = gtk_label_new("Quantum (Round-Robin / nível 0 do MLFQ):");
+    GtkWidget *spin_quantum = gtk_spin_button_new_with_range(1, 1000000, 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(spin_quantum), QUANTUM_PADRAO);
+    gtk_box_pack_start(GTK_BOX(hbox_quantum), label_quantum, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(hbox_quantum), spin_quantum, TRUE, TRUE, 0);
+    gtk_container_add(GTK_CONTAINER(content_area), hbox_quantum);
+
+    // Quantidade de CPUs, roubo de trabalho e custo de migração
+    GtkWidget *grid_cpus = gtk_grid_new();
+    gtk_grid_set_row_spacing(GTK_GRID(grid_cpus), 5);
+    gtk_grid_set_column_spacing(GTK_GRID(grid_cpus), 5);
+    GtkWidget *spin_cpus = gtk_spin_button_new_with_range(1, MAX_CPUS, 1);
+    GtkWidget *spin_migracao = gtk_spin_button_new_with_range(0, 1000000, 1);
+    GtkWidget *check_roubo = gtk_check_button_new_with_label("Roubo de trabalho entre CPUs");
+    gtk_grid_attach(GTK_GRID(grid_cpus), gtk_label_new("CPUs:"), 0, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cpus), spin_cpus, 1, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cpus), gtk_label_new("Custo de migração:"), 0, 1, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cpus), spin_migracao, 1, 1, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cpus), check_roubo, 0, 2, 2, 1);
+    gtk_container_add(GTK_CONTAINER(content_area), grid_cpus);
+
+    // Níveis e boost do MLFQ (o quantum dobra a cada nível)
+    GtkWidget *grid_mlfq = gtk_grid_new();
+    gtk_grid_set_row_spacing(GTK_GRID(grid_mlfq), 5);
+    gtk_grid_set_column_spacing(GTK_GRID(grid_mlfq), 5);
+    GtkWidget *spin_niveis = gtk_spin_button_new_with_range(1, MAX_NIVEIS_MLFQ, 1);
+    GtkWidget *spin_boost = gtk_spin_button_new_with_range(0, 1000000000, 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(spin_niveis), 3);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(spin_boost), 50 * QUANTUM_PADRAO);
+    gtk_grid_attach(GTK_GRID(grid_mlfq), gtk_label_new("Níveis (MLFQ):"), 0, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_mlfq), spin_niveis, 1, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_mlfq), gtk_label_new("Período do boost (0 = sem):"), 0, 1, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_mlfq), spin_boost, 1, 1, 1, 1);
+    gtk_container_add(GTK_CONTAINER(content_area), grid_mlfq);
+
+    // Latência alvo e granularidade mínima do CFS
+    ConfigCFS padrao_cfs;
+    cfs_config_padrao(&padrao_cfs);
+    GtkWidget *grid_cfs = gtk_grid_new();
+    gtk_grid_set_row_spacing(GTK_GRID(grid_cfs), 5);
+    gtk_grid_set_column_spacing(GTK_GRID(grid_cfs), 5);
+    GtkWidget *spin_latencia = gtk_spin_button_new_with_range(1, 1000000, 1);
+    GtkWidget *spin_granularidade = gtk_spin_button_new_with_range(1, 1000000, 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(spin_latencia), padrao_cfs.latencia_alvo);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(spin_granularidade), padrao_cfs.granularidade_minima);
+    gtk_grid_attach(GTK_GRID(grid_cfs), gtk_label_new("Latência alvo (CFS):"), 0, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cfs), spin_latencia, 1, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cfs), gtk_label_new("Granularidade mínima (CFS):"), 0, 1, 1, 1);
+    gtk_grid_attach(GTK_GRID(grid_cfs), spin_granularidade, 1, 1, 1, 1);
+    gtk_container_add(GTK_CONTAINER(content_area), grid_cfs);
+
     // Executa a seleção
     gtk_widget_show_all(dialog);
 
     gint response = gtk_dialog_run(GTK_DIALOG(dialog));
     if (response == GTK_RESPONSE_OK) {
         int selected_index = gtk_combo_box_get_active(GTK_COMBO_BOX(combo_algoritmo));
+        int quantum = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_quantum));
+        ConfigMultiCPU config;
+        multicpu_config_padrao(&config);
+        config.n_cpus = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_cpus));
+        config.custo_migracao = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_migracao));
+        config.roubo = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(check_roubo));
+
+        ParametrosSimulacao parametros;
+        parametros_padrao(&parametros, quantum);
+        ConfigMLFQ *mlfq = &parametros.mlfq;
+        mlfq->n_niveis = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_niveis));
+        mlfq->periodo_boost = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_boost));
+        for (int l = 0; l < mlfq->n_niveis; l++) {
+            // Dobra o quantum a cada nível, sem passar do maior int
+            mlfq->quanta[l] = (l < 30 && quantum <= (1 << 30) >> l) ? quantum << l : 1 << 30;
+        }
+        parametros.cfs.latencia_alvo = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_latencia));
+        parametros.cfs.granularidade_minima = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spin_granularidade));
+
         if (selected_index >= 0) {
             // Aqui chamamos a função para rodar o algoritmo
-            executar_escalonamento(selected_index, parent);
+            executar_escalonamento(selected_index, &parametros, &config, parent);
         }
     }
 
     gtk_widget_destroy(dialog);
 }
 
+// Uma simulação executada em segundo plano, com sua própria cópia da lista
+typedef struct {
+    Algoritmo algoritmo;            // Algoritmo escolhido
+    ParametrosSimulacao parametros; // Quantum, MLFQ e CFS
+    ConfigMultiCPU config;          // CPUs, roubo de trabalho e custo de migração
+    Processo *processos;            // Cópia da lista no momento da execução, em ordem de chegada
+    int *ordem;                     // Ordem de chegada da cópia (a identidade; só com várias CPUs)
+    int n;                          // Quantidade de processos copiados
+    ResultadoSimulacao res;         // Resultado preenchido pela thread
+    BufferSaida saida;              // Texto do resultado, formatado também na thread
+    RetomadaSimulacao retomada;     // Pontos de retomada (só com uma CPU)
+    int partida;                    // Ponto de onde esta execução continua a anterior (-1 = do início)
+    ControleSimulacao controle;     // Progresso e cancelamento compartilhados com a interface
+    GtkWidget *janela;              // Janela de progresso
+    GtkWidget *barra;               // Barra de progresso (processos concluídos)
+    GtkWidget *rotulo;              // Tempo simulado e contagem de processos
+    guint temporizador;             // Fonte que atualiza a janela de progresso
+} TarefaSimulacao;
+
+// Intervalo entre atualizações da janela de progresso (ms)
+#define INTERVALO_PROGRESSO 100
+
+// Última simulação concluída: com os mesmos parâmetros, a próxima execução mostra
+// o mesmo resultado se a lista não mudou, ou continua do último ponto de retomada
+// anterior à mudança (ver retomada.h). Fica NULL enquanto é reaproveitada pela thread
+static TarefaSimulacao *ultima_simulacao = NULL;
+
+// Simulação com uma CPU: a única que guarda pontos de retomada
+static int usa_uma_cpu(Algoritmo algoritmo, const ConfigMultiCPU *config) {
+    return !(config->n_cpus > 1 && multicpu_suporta(algoritmo));
+}
+
+// Mesmo algoritmo e parâmetros da tarefa (as CPUs só contam na simulação com várias)
+static int mesma_configuracao(const TarefaSimulacao *tarefa, Algoritmo algoritmo,
+                              const ParametrosSimulacao *parametros, const ConfigMultiCPU *config) {
+    if (tarefa->algoritmo != algoritmo
+        || memcmp(&tarefa->parametros, parametros, sizeof(ParametrosSimulacao)) != 0) {
+        return 0;
+    }
+    int uma_cpu = usa_uma_cpu(algoritmo, config);
+    if (uma_cpu != usa_uma_cpu(tarefa->algoritmo, &tarefa->config)) {
+        return 0;
+    }
+    return uma_cpu || memcmp(&tarefa->config, config, sizeof(ConfigMultiCPU)) == 0;
+}
+
+static void liberar_tarefa(TarefaSimulacao *tarefa) {
+    resultado_liberar(&tarefa->res);
+    buffer_liberar(&tarefa->saida);
+    retomada_liberar(&tarefa->retomada);
+    g_free(tarefa->processos);
+    g_free(tarefa->ordem);
+    g_free(tarefa);
+}
+
+// Atualiza a janela de progresso com os valores publicados pela simulação
+static gboolean atualizar_progresso(gpointer user_data) {
+    TarefaSimulacao *tarefa = user_data;
+    int concluidos = atomic_load_explicit(&tarefa->controle.concluidos, memory_order_relaxed);
+    int tempo = atomic_load_explicit(&tarefa->controle.tempo_atual, memory_order_relaxed);
+    char texto[128];
+
+    snprintf(texto, sizeof(texto), "Tempo simulado: %d — %d de %d processos concluídos",
+             tempo, concluidos, tarefa->n);
+    gtk_label_set_text(GTK_LABEL(tarefa->rotulo), texto);
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(tarefa->barra),
+                                  tarefa->n > 0 ? (double)concluidos / tarefa->n : 1.0);
+    return TRUE;    // Continua até a simulação terminar
+}
+
+// Botão cancelar: apenas sinaliza; a thread encerra na próxima verificação
+static void on_btn_cancelar_simulacao_clicked(GtkButton *button, gpointer user_data) {
+    TarefaSimulacao *tarefa = user_data;
+    atomic_store(&tarefa->controle.cancelar, 1);
+    gtk_widget_set_sensitive(GTK_WIDGET(button), FALSE);
+    gtk_label_set_text(GTK_LABEL(tarefa->rotulo), "Cancelando...");
+}
+
+// Executada na thread principal quando a simulação termina (ou é cancelada)
+static gboolean on_simulacao_concluida(gpointer user_data) {
+    TarefaSimulacao *tarefa = user_data;
+
+    g_source_remove(tarefa->temporizador);
+    gtk_widget_destroy(tarefa->janela);
+
+    if (tarefa->res.cancelada || tarefa->res.estouro_relogio) {
+        g_print(tarefa->res.cancelada ? "Simulação cancelada.\n"
+                                      : "O relógio da simulação passou do limite de tempo.\n");
+        liberar_tarefa(tarefa);     // O resultado incompleto não serve para continuar
+        return FALSE;
+    }
+
+    abrir_resultado_simulacao(&tarefa->res, &tarefa->saida);
+    if (ultima_simulacao != NULL) {
+        liberar_tarefa(ultima_simulacao);
+    }
+    ultima_simulacao = tarefa;
+    return FALSE;   // Executa uma única vez
+}
+
+// Corpo da thread: simula sobre a cópia da lista e formata o texto do resultado
+static gpointer executar_tarefa(gpointer user_data) {
+    TarefaSimulacao *tarefa = user_data;
+
+    // Algoritmos sem versão com várias CPUs rodam em uma CPU
+    if (!usa_uma_cpu(tarefa->algoritmo, &tarefa->config)) {
+        simular_multicpu(tarefa->algoritmo, tarefa->processos, tarefa->n, tarefa->ordem,
+                         tarefa->parametros.quantum, &tarefa->config, &tarefa->res);
+    } else if (!simular_com_retomada(tarefa->algoritmo, tarefa->processos, tarefa->n, &tarefa->parametros,
+                                     &tarefa->retomada, tarefa->partida, &tarefa->res)) {
+        // Sem memória para os pontos: simula do início, sem eles
+        retomada_liberar(&tarefa->retomada);
+        simular_com_parametros(tarefa->algoritmo, tarefa->processos, tarefa->n, NULL,
+                               &tarefa->parametros, &tarefa->res);
+    }
+    if (!tarefa->res.cancelada && !tarefa->res.estouro_relogio) {
+        INSTR_INICIAR_FASE(&tarefa->res, FASE_FORMATACAO);
+        formatar_resultado_texto(&tarefa->res, &tarefa->saida);
+        INSTR_ENCERRAR_FASE(&tarefa->res, FASE_FORMATACAO);
+    }
+
+    // Widgets só podem ser tocados na thread principal
+    g_idle_add(on_simulacao_concluida, tarefa);
+    return NULL;
+}
+
+// Cria a janela que mostra o progresso da tarefa e permite cancelá-la
+static void abrir_janela_progresso(TarefaSimulacao *tarefa, GtkWidget *parent) {
+    tarefa->janela = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_title(GTK_WINDOW(tarefa->janela), "Simulando...");
+    gtk_window_set_transient_for(GTK_WINDOW(tarefa->janela), GTK_WINDOW(gtk_widget_get_toplevel(parent)));
+    gtk_window_set_default_size(GTK_WINDOW(tarefa->janela), 400, -1);
+    gtk_window_set_deletable(GTK_WINDOW(tarefa->janela), FALSE);  // Fechar apenas pelo Cancelar
+
+    GtkWidget *vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    gtk_container_set_border_width(GTK_CONTAINER(vbox), 10);
+    gtk_container_add(GTK_CONTAINER(tarefa->janela), vbox);
+
+    tarefa->rotulo = gtk_label_new("Iniciando...");
+    tarefa->barra = gtk_progress_bar_new();
+    GtkWidget *btn_cancelar = gtk_button_new_with_label("Cancelar");
+    gtk_box_pack_start(GTK_BOX(vbox), tarefa->rotulo, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(vbox), tarefa->barra, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(vbox), btn_cancelar, FALSE, FALSE, 0);
+    g_signal_connect(btn_cancelar, "clicked", G_CALLBACK(on_btn_cancelar_simulacao_clicked), tarefa);
+
+    gtk_widget_show_all(tarefa->janela);
+    tarefa->temporizador = g_timeout_add(INTERVALO_PROGRESSO, atualizar_progresso, tarefa);
+}
+
 // Executar algoritmo
-void executar_escalonamento(int algoritmo_index, GtkWidget *widget) {
-    char output_buffer[4096]; // Ajuste se necessário
-
-    switch (algoritmo_index) {
-        case 0: // FIFO
-            simular_FIFO(lista_processos, n_processos, output_buffer);
-            break;
-        case 1: // SJF
-            simular_sjf(lista_processos, n_processos, output_buffer);
-            break;
-        case 2: // Round-Robin
-            simular_round_robin(lista_processos, n_processos, output_buffer);
-            break;
-        case 3: // Prioridade Preemptivo
-            simular_prioridade(lista_processos, n_processos, output_buffer);
-            break;
-        default:
-            strcpy(output_buffer, "Algoritmo não implementado.");
+// A simulação roda em uma thread separada sobre uma cópia da lista, então a
+// interface continua respondendo e a lista pode ser editada durante a execução.
+// Com os mesmos parâmetros da última simulação, reaproveita o que ainda vale dela
+void executar_escalonamento(int algoritmo_index, const ParametrosSimulacao *parametros,
+                            const ConfigMultiCPU *config, GtkWidget *widget) {
+    if (algoritmo_index < 0 || algoritmo_index >= N_ALGORITMOS) {
+        BufferSaida saida;
+        buffer_inicializar(&saida);
+        buffer_anexar(&saida, "Algoritmo não implementado.");
+        abrir_resultado_simulacao(NULL, &saida);
+        buffer_liberar(&saida);
+        return;
+    }
+
+    Algoritmo algoritmo = (Algoritmo)algoritmo_index;
+    int n = lista_processos.n;
+
+    // Cópia da lista em ordem de chegada (calculada aqui, na thread principal)
+    const int *ordem = ordem_por_chegada(&lista_processos);
+    if (ordem == NULL) {
+        g_print("Memória insuficiente para simular.\n");
+        return;
+    }
+    Processo *processos = g_malloc((gsize)(n > 0 ? n : 1) * sizeof(Processo));
+    for (int k = 0; k < n; k++) {
+        processos[k] = lista_processos.itens[ordem[k]];
+    }
+
+    TarefaSimulacao *tarefa = ultima_simulacao;
+    if (tarefa != NULL && !mesma_configuracao(tarefa, algoritmo, parametros, config)) {
+        tarefa = NULL;
+    }
+    if (tarefa != NULL && tarefa->n == n && memcmp(tarefa->processos, processos, (gsize)n * sizeof(Processo)) == 0) {
+        // Nada mudou desde a última simulação: mostra o mesmo resultado
+        g_free(processos);
+        abrir_resultado_simulacao(&tarefa->res, &tarefa->saida);
+        return;
     }
 
-    abrir_resultado_simulacao(output_buffer);
+    if (tarefa != NULL && usa_uma_cpu(algoritmo, config)) {
+        // Continua a última simulação do ponto anterior à primeira mudança
+        tarefa->partida = retomada_escolher(&tarefa->retomada, tarefa->processos, tarefa->n, processos, n);
+        if (tarefa->partida >= 0) {
+            g_print("Continuando a simulação anterior a partir do instante %d.\n",
+                    tarefa->retomada.pontos[tarefa->partida].tempo);
+        }
+        ultima_simulacao = NULL;    // Volta a ser a última quando terminar
+        g_free(tarefa->processos);
+        buffer_limpar(&tarefa->saida);
+        atomic_store(&tarefa->controle.cancelar, 0);
+    } else {
+        tarefa = g_new0(TarefaSimulacao, 1);
+        tarefa->algoritmo = algoritmo;
+        tarefa->parametros = *parametros;
+        tarefa->config = *config;
+        tarefa->partida = -1;
+        resultado_inicializar(&tarefa->res);
+        buffer_inicializar(&tarefa->saida);
+        retomada_inicializar(&tarefa->retomada);
+        tarefa->res.controle = &tarefa->controle;
+        if (!usa_uma_cpu(algoritmo, config)) {
+            tarefa->ordem = g_malloc((gsize)(n > 0 ? n : 1) * sizeof(int));
+            for (int k = 0; k < n; k++) {
+                tarefa->ordem[k] = k;       // A cópia já está em ordem de chegada
+            }
+        }
+    }
+    tarefa->processos = processos;
+    tarefa->n = n;
+
+    abrir_janela_progresso(tarefa, widget);
+    g_thread_unref(g_thread_new("simulacao", executar_tarefa, tarefa));
 }
 
 // Mostrar Resultado
-void abrir_resultado_simulacao(const char *resultado) {
+// Com um resultado (res != NULL), mostra o gráfico de Gantt e o texto em abas
+void abrir_resultado_simulacao(const ResultadoSimulacao *res, const BufferSaida *resultado) {
     GtkWidget *window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
     gtk_window_set_title(GTK_WINDOW(window), "Resultado da Simulação");
-    gtk_window_set_default_size(GTK_WINDOW(window), 600, 400);
+    gtk_window_set_default_size(GTK_WINDOW(window), 800, 500);
 
     GtkWidget *vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
     gtk_container_set_border_width(GTK_CONTAINER(vbox), 10);
@@ -293,8 +719,36 @@ void abrir_resultado_simulacao(const char *resultado) {
 
     GtkWidget *textview = gtk_text_view_new();
     gtk_text_view_set_editable(GTK_TEXT_VIEW(textview), FALSE);
-    gtk_text_buffer_set_text(gtk_text_view_get_buffer(GTK_TEXT_VIEW(textview)), resultado, -1);
-    gtk_box_pack_start(GTK_BOX(vbox), textview, TRUE, TRUE, 0);
+    gtk_text_buffer_set_text(gtk_text_view_get_buffer(GTK_TEXT_VIEW(textview)),
+                             resultado->dados, (gint)resultado->tamanho);
+    GtkWidget *scroll = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scroll), GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_container_add(GTK_CONTAINER(scroll), textview);
+
+    if (res != NULL) {
+        // Gantt (roda do mouse amplia, arrastar move, clique duplo mostra tudo) e texto
+        GtkWidget *notebook = gtk_notebook_new();
+        gtk_notebook_append_page(GTK_NOTEBOOK(notebook), gantt_novo(res), gtk_label_new("Gráfico de Gantt"));
+        gtk_notebook_append_page(GTK_NOTEBOOK(notebook), scroll, gtk_label_new("Texto"));
+
+        // Contadores internos do simulador, quando compilado com a instrumentação
+        if (res->instr.ativa) {
+            BufferSaida json;
+            buffer_inicializar(&json);
+            formatar_instrumentacao_json(res, &json);
+            GtkWidget *textview_json = gtk_text_view_new();
+            gtk_text_view_set_editable(GTK_TEXT_VIEW(textview_json), FALSE);
+            gtk_text_view_set_monospace(GTK_TEXT_VIEW(textview_json), TRUE);
+            gtk_text_view_set_wrap_mode(GTK_TEXT_VIEW(textview_json), GTK_WRAP_CHAR);
+            gtk_text_buffer_set_text(gtk_text_view_get_buffer(GTK_TEXT_VIEW(textview_json)),
+                                     json.dados, (gint)json.tamanho);
+            buffer_liberar(&json);
+            gtk_notebook_append_page(GTK_NOTEBOOK(notebook), textview_json, gtk_label_new("Instrumentação"));
+        }
+        gtk_box_pack_start(GTK_BOX(vbox), notebook, TRUE, TRUE, 0);
+    } else {
+        gtk_box_pack_start(GTK_BOX(vbox), scroll, TRUE, TRUE, 0);
+    }
 
     gtk_widget_show_all(window);
 }
@@ -9,14 +9,24 @@
 #define INTERFACE_H
 
 #include <gtk/gtk.h>
+#include "buffer.h"
+#include "resultado.h"
+#include "processos.h"
+#include "multicpu.h"
+#include "simulador.h"
 
 void abrir_tela_processos();
 void abrir_dialogo_adicionar_processo(GtkWidget *parent);
-void atualizar_lista(GtkWidget *listbox);
+void atualizar_lista(void);
+void adicionar_linha_processo(const Processo *p);
+void remover_linha_processo(int pid);
 void on_btn_remover_clicked(GtkButton *button, gpointer user_data);
 void on_btn_reinicializar_clicked(GtkButton *button, gpointer user_data);
+void on_btn_carregar_clicked(GtkButton *button, gpointer user_data);
+void on_btn_salvar_clicked(GtkButton *button, gpointer user_data);
 void abrir_tela_selecao_algoritmo(GtkWidget *widget);
-void executar_escalonamento(int algoritmo_index, GtkWidget *widget);
-void abrir_resultado_simulacao(const char *resultado);
+void executar_escalonamento(int algoritmo_index, const ParametrosSimulacao *parametros,
+                            const ConfigMultiCPU *config, GtkWidget *widget);
+void abrir_resultado_simulacao(const ResultadoSimulacao *res, const BufferSaida *resultado);
 
 #endif
\ No newline at end of file
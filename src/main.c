@@ -14,19 +14,19 @@
 // Declarações externas da interface
 void abrir_tela_processos();
 
-// Lista global de processos e contador
-Processo *lista_processos = NULL;
-int n_processos = 0;
+// Lista global de processos
+ListaProcessos lista_processos;
 
 int main(int argc, char *argv[]) {
     gtk_init(&argc, &argv);
+    inicializar_lista(&lista_processos);
 
     abrir_tela_processos();
 
     gtk_main();
 
     // Ao fechar o app, libera a lista
-    reinicializar_lista(&lista_processos, &n_processos);
+    reinicializar_lista(&lista_processos);
 
     return 0;
 }
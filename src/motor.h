@@ -0,0 +1,388 @@
+/**
+ * @file motor.h
+ * @brief Motor de simulação orientado a eventos, comum a todos os algoritmos de uma CPU.
+ *
+ * O motor cuida do que todos os algoritmos fazem igual: relógio, admissão dos
+ * processos em ordem de chegada, salto da CPU ociosa até a próxima chegada,
+ * tempo restante, registro dos intervalos e das conclusões, cancelamento e
+ * instrumentação. Cada algoritmo é uma Politica: um conjunto de funções que
+ * decidem quem executa e por quanto tempo.
+ *
+ * executar_motor é sempre expandida em quem a chama, e cada algoritmo passa
+ * uma Politica constante: o compilador troca as chamadas pelos ganchos da
+ * política e os expande também, então cada algoritmo vira um laço próprio, sem
+ * chamada indireta por decisão. Uso interno de simulador.c.
+ *
+ * Em fluxo, os processos vêm de uma FonteProcessos: cada um ocupa uma vaga ao
+ * chegar e a devolve ao terminar, e os índices que as políticas recebem são
+ * vagas. Os vetores por processo (do motor e da política) crescem com as vagas.
+ *
+ * Com pontos de retomada (ver retomada.h), o motor guarda o estado no começo
+ * de uma volta a cada RetomadaSimulacao.passo chegadas e pode começar de um
+ * ponto guardado em vez do instante 0.
+ */
+
+#ifndef MOTOR_H               // Evita inclusão duplicada
+#define MOTOR_H
+
+#include <stdlib.h>           // realloc, abort
+#include <limits.h>           // INT_MAX
+#include "processos.h"        // Definição da struct Processo
+#include "resultado.h"        // Resultado, intervalos e instrumentação
+#include "simulador.h"        // FonteProcessos e FuncaoConclusao
+#include "retomada.h"         // Pontos de retomada
+
+// Força a expansão da função em quem a chama (GCC/Clang); nos demais, apenas sugere
+#if defined(__GNUC__)
+#define SEMPRE_INLINE static inline __attribute__((always_inline))
+#else
+#define SEMPRE_INLINE static inline
+#endif
+
+// Vagas iniciais de uma simulação em fluxo (dobram quando acabam)
+#define VAGAS_INICIAIS 64
+
+// Modo de uma chamada de executar_motor, sempre uma constante
+typedef enum {
+    MOTOR_LISTA,                        // Lista completa em `processos`
+    MOTOR_FLUXO,                        // Processos lidos de uma FonteProcessos
+    MOTOR_RETOMADA                      // Lista completa em ordem de chegada, com pontos de retomada
+} ModoMotor;
+
+// Estado comum a todas as políticas, mantido pelo motor
+typedef struct {
+    const Processo *processos;          // Processos simulados (em fluxo: o processo de cada vaga)
+    int n;                              // Posições dos vetores por processo (em fluxo: quantidade de vagas)
+    int *restante;                      // Tempo de execução que falta a cada processo (NULL se não preemptiva)
+    ResultadoSimulacao *res;            // Resultado sendo preenchido
+    void *politica;                     // Estado próprio da política (filas, pesos, ...)
+    // Somente em fluxo
+    FonteProcessos *fonte;              // De onde vêm os processos (NULL = lista completa em `processos`)
+    Processo *vagas;                    // Processo de cada vaga (o mesmo vetor de `processos`)
+    int *livres;                        // Pilha de vagas livres
+    int n_livres;
+    Processo proximo;                   // Próximo processo da fonte, que ainda não chegou
+    int tem_proximo;                    // 0 depois do último processo (ou de um erro da fonte)
+    int erro_fonte;                     // 1 se a fonte falhou
+    FuncaoConclusao concluiu;           // Recebe as métricas de cada processo concluído (pode ser NULL)
+    void *contexto;                     // Repassado a `concluiu`
+    // Somente com pontos de retomada
+    RetomadaSimulacao *retomada;
+} Motor;
+
+// Ganchos de uma política de escalonamento; os marcados como opcionais podem ser NULL
+// Cada política é uma constante com inicializadores designados (campos omitidos = 0/NULL)
+typedef struct {
+    // 0 = cada processo executa de uma vez até terminar: o motor dispensa o tempo
+    // restante, a fatia e a devolução, e o laço fica tão enxuto quanto um FIFO escrito à mão
+    int preemptiva;
+    // 1 = atende na ordem de chegada (FIFO): a fila é implícita, nenhum gancho é
+    // chamado e a CPU ociosa só adianta o relógio até a chegada do próximo, sem desvio
+    int em_ordem_de_chegada;
+    // Processo i chegou e deve entrar na fila de prontos
+    void (*chegou)(Motor *m, int i);
+    // Quantidade de processos prontos (sem contar o que está executando)
+    int (*tamanho)(const Motor *m);
+    // Remove da fila e retorna o próximo processo a executar (só chamada com a fila não vazia)
+    int (*escolher)(Motor *m);
+    // Por quanto tempo, no máximo, o processo i executa a partir de `tempo`; o motor
+    // ainda limita pelo tempo restante. proxima_chegada é -1 quando ninguém mais chega
+    // (apenas políticas preemptivas)
+    int (*fatia)(Motor *m, int i, int tempo, int proxima_chegada);
+    // Opcional: o processo i executou `executado` unidades (antes das novas chegadas entrarem)
+    void (*executou)(Motor *m, int i, int executado);
+    // O processo i não terminou e volta para a fila, depois das chegadas durante a
+    // fatia (apenas políticas preemptivas)
+    void (*devolver)(Motor *m, int i);
+    // Opcional: o processo i terminou
+    void (*concluiu)(Motor *m, int i);
+    // Opcional: o relógio chegou a `tempo`, depois de uma fatia ou de um salto ocioso
+    void (*tempo_avancou)(Motor *m, int tempo);
+    // Opcional, só em fluxo: as vagas passaram de `anterior` para m->n e o estado
+    // por processo da política deve crescer junto
+    void (*crescer)(Motor *m, int anterior);
+    // Com pontos de retomada (exceto em ordem de chegada): preenche índice, nível e
+    // valor de cada pronto do ponto, na ordem da fila, e o estado global
+    void (*salvar)(const Motor *m, PontoRetomada *ponto);
+    // Opcional: refaz a fila e o estado da política a partir do ponto; sem ele,
+    // os prontos voltam com `chegou`, na ordem guardada
+    void (*restaurar)(Motor *m, const PontoRetomada *ponto);
+} Politica;
+
+// Lê o próximo processo da fonte
+static inline void motor_ler_fonte(Motor *m) {
+    int lido = m->fonte->proximo(m->fonte->contexto, &m->proximo);
+    m->tem_proximo = lido > 0;
+    if (lido < 0) {
+        m->erro_fonte = 1;
+    }
+}
+
+// Dobra as vagas; as novas vão para a pilha de livres, com a menor no topo
+static inline void motor_crescer_vagas(Motor *m, int preemptiva) {
+    int anterior = m->n;
+    int nova = anterior > 0 ? 2 * anterior : VAGAS_INICIAIS;
+    Processo *vagas = realloc(m->vagas, nova * sizeof(Processo));
+    int *livres = realloc(m->livres, nova * sizeof(int));
+    int *restante = preemptiva ? realloc(m->restante, nova * sizeof(int)) : NULL;
+    if (vagas == NULL || livres == NULL || (preemptiva && restante == NULL)) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    for (int i = nova - 1; i >= anterior; i--) {
+        livres[m->n_livres++] = i;
+    }
+    m->vagas = vagas;
+    m->processos = vagas;
+    m->livres = livres;
+    m->restante = restante;
+    m->n = nova;
+    resultado_reservar_vagas(m->res, nova);
+}
+
+// Ainda há processo para chegar?
+SEMPRE_INLINE int motor_ha_chegada(const Motor *m, const int fluxo, int cursor, int n) {
+    return fluxo ? m->tem_proximo : cursor < n;
+}
+
+// Instante da próxima chegada (só quando motor_ha_chegada)
+SEMPRE_INLINE int motor_proxima_chegada(const Motor *m, const int fluxo, const Processo *processos,
+                                        const int *ordem, int cursor) {
+    return fluxo ? m->proximo.tempo_chegada : processos[ordem[cursor]].tempo_chegada;
+}
+
+// O próximo processo chega; retorna o índice dele (em fluxo, a vaga que ocupou)
+// Em fluxo, `pendentes` passa a contar também o processo seguinte da fonte, se houver,
+// e m->processos e m->restante podem mudar de endereço
+SEMPRE_INLINE int motor_admitir(const Politica *p, Motor *m, const int fluxo, const int *ordem,
+                                int *cursor, int *pendentes) {
+    if (!fluxo) {
+        return ordem[(*cursor)++];
+    }
+    if (m->n_livres == 0) {
+        int anterior = m->n;
+        motor_crescer_vagas(m, p->preemptiva);
+        if (p->crescer != NULL) {
+            p->crescer(m, anterior);
+        }
+    }
+    int i = m->livres[--m->n_livres];
+    m->vagas[i] = m->proximo;
+    if (p->preemptiva) {
+        m->restante[i] = m->proximo.tempo_execucao;
+    }
+    resultado_admitir(m->res, i, &m->proximo);
+    motor_ler_fonte(m);
+    *pendentes += m->tem_proximo;
+    return i;
+}
+
+// Em fluxo, entrega as métricas do processo concluído e libera a vaga
+SEMPRE_INLINE void motor_liberar_vaga(Motor *m, const int fluxo, int i) {
+    if (fluxo) {
+        if (m->concluiu != NULL) {
+            m->concluiu(m->contexto, &m->res->metricas[i]);
+        }
+        m->livres[m->n_livres++] = i;
+    }
+}
+
+// Guarda um ponto de retomada no começo de uma volta, com a CPU livre
+// Sem memória, a simulação segue sem este ponto
+static inline void motor_guardar_ponto(const Politica *p, Motor *m, int tempo, int cursor) {
+    RetomadaSimulacao *r = m->retomada;
+    int n_prontos = p->em_ordem_de_chegada ? 0 : p->tamanho(m);
+    PontoRetomada *ponto = retomada_novo_ponto(r, n_prontos);
+    r->proximo = cursor + r->passo;
+    if (ponto == NULL) {
+        return;
+    }
+
+    ponto->tempo = tempo;
+    ponto->admitidos = cursor;
+    if (n_prontos > 0) {
+        p->salvar(m, ponto);
+        for (int k = 0; k < n_prontos; k++) {
+            ProntoRetomada *pr = &ponto->prontos[k];
+            pr->restante = p->preemptiva ? m->restante[pr->indice] : m->processos[pr->indice].tempo_execucao;
+            pr->inicio = m->res->metricas[pr->indice].inicio;
+        }
+    }
+    retomada_guardar_resultado(ponto, m->res);
+}
+
+// Continua do ponto de partida: relógio, chegadas, tempo restante e fila de prontos
+// (o resultado já foi restaurado por retomada_restaurar_resultado)
+static inline void motor_retomar(const Politica *p, Motor *m, int *tempo, int *cursor, int *pendentes) {
+    const PontoRetomada *ponto = &m->retomada->pontos[m->retomada->partida];
+    *tempo = ponto->tempo;
+    *cursor = ponto->admitidos;
+    *pendentes = m->n - ponto->n_concluidos;
+    if (p->preemptiva) {
+        for (int k = 0; k < ponto->n_prontos; k++) {
+            m->restante[ponto->prontos[k].indice] = ponto->prontos[k].restante;
+        }
+    }
+    if (p->restaurar != NULL) {
+        p->restaurar(m, ponto);
+    } else {
+        for (int k = 0; k < ponto->n_prontos; k++) {
+            p->chegou(m, ponto->prontos[k].indice);
+        }
+    }
+}
+
+// Simula a política sobre os processos, na ordem de chegada informada (ignorada em fluxo)
+// O chamador prepara o resultado (resultado_preparar) e o estado da política;
+// em políticas preemptivas, m->restante deve ter espaço para m->n valores e é preenchido aqui.
+// `modo` deve ser uma constante em cada chamada: assim a simulação da lista
+// completa não carrega o código (nem os testes) da simulação em fluxo nem dos pontos
+// de retomada. Com MOTOR_RETOMADA, a ordem é a identidade e m->retomada já foi
+// preparada (retomada_preparar), assim como o resultado, se houver ponto de partida
+SEMPRE_INLINE void executar_motor(const Politica *p, Motor *m, const int *ordem, const ModoMotor modo) {
+    const int fluxo = modo == MOTOR_FLUXO;
+    const int retomada = modo == MOTOR_RETOMADA;
+    const Processo *processos = m->processos;   // Em fluxo, relidos depois de cada chegada
+    int *restante = m->restante;
+    ResultadoSimulacao *res = m->res;
+    int n = m->n;
+    int tempo_atual = 0;                // Relógio da simulação
+    int cursor = 0;                     // Próximo processo (na ordem de chegada) que ainda não chegou
+    int pendentes;                      // Processos ainda não concluídos (em fluxo: residentes e o próximo da fonte)
+
+    if (fluxo) {
+        pendentes = m->tem_proximo;
+    } else {
+        pendentes = n;
+        if (p->preemptiva) {
+            for (int i = 0; i < n; i++) {
+                restante[i] = processos[i].tempo_execucao;
+            }
+        }
+        if (retomada && m->retomada->partida >= 0) {
+            motor_retomar(p, m, &tempo_atual, &cursor, &pendentes);
+        }
+    }
+
+    INSTR_INICIAR_FASE(res, FASE_SIMULACAO);
+
+    if (p->em_ordem_de_chegada) {
+#ifdef ESCALONADOR_INSTRUMENTACAO
+        int chegados = 0;               // Processos que já chegaram (apenas para medir a fila)
+#endif
+        while (motor_ha_chegada(m, fluxo, cursor, n) && !resultado_interrompido(res, tempo_atual)) {
+            if (retomada && cursor >= m->retomada->proximo) {
+                motor_guardar_ponto(p, m, tempo_atual, cursor);
+            }
+            int i = motor_admitir(p, m, fluxo, ordem, &cursor, &pendentes);
+            if (fluxo) {
+                processos = m->processos;
+            }
+            int chegada = processos[i].tempo_chegada;
+            if (chegada > tempo_atual) {
+                INSTR_SALTO_OCIOSO(res);
+            }
+            tempo_atual = chegada > tempo_atual ? chegada : tempo_atual;
+#ifdef ESCALONADOR_INSTRUMENTACAO
+            // Em fluxo os próximos processos não são conhecidos: conta só o atual
+            chegados = chegados > cursor ? chegados : cursor;
+            while (!fluxo && chegados < n && processos[ordem[chegados]].tempo_chegada <= tempo_atual) {
+                chegados++;
+            }
+#endif
+            INSTR_DECISAO(res, i, chegados - cursor + 1);
+
+            if (processos[i].tempo_execucao > INT_MAX - tempo_atual) {
+                res->estouro_relogio = 1;   // O relógio passaria de INT_MAX
+                break;
+            }
+            int tempo_inicio = tempo_atual;
+            tempo_atual += processos[i].tempo_execucao;
+            resultado_registrar_intervalo(res, i, tempo_inicio, tempo_atual);
+            resultado_registrar_conclusao(res, i, tempo_atual);
+            motor_liberar_vaga(m, fluxo, i);
+        }
+        pendentes = 0;
+    }
+
+    while (pendentes > 0 && !resultado_interrompido(res, tempo_atual)) {
+        // Quem chegou até agora entra na fila de prontos
+        while (motor_ha_chegada(m, fluxo, cursor, n) && motor_proxima_chegada(m, fluxo, processos, ordem, cursor) <= tempo_atual) {
+            p->chegou(m, motor_admitir(p, m, fluxo, ordem, &cursor, &pendentes));
+        }
+        if (fluxo) {
+            processos = m->processos;
+            restante = m->restante;
+        }
+        if (retomada && cursor >= m->retomada->proximo) {
+            motor_guardar_ponto(p, m, tempo_atual, cursor);
+        }
+
+        // Nenhum processo pronto: salta direto para a próxima chegada
+        if (p->tamanho(m) == 0) {
+            tempo_atual = motor_proxima_chegada(m, fluxo, processos, ordem, cursor);
+            if (p->tempo_avancou != NULL) {
+                p->tempo_avancou(m, tempo_atual);
+            }
+            INSTR_SALTO_OCIOSO(res);
+            continue;
+        }
+
+        int i = p->escolher(m);
+        INSTR_DECISAO(res, i, p->tamanho(m) + 1);
+
+        // Executa pela fatia da política, sem passar do que falta ao processo
+        int tempo_exec = processos[i].tempo_execucao;
+        if (p->preemptiva) {
+            int proxima_chegada = motor_ha_chegada(m, fluxo, cursor, n)
+                                      ? motor_proxima_chegada(m, fluxo, processos, ordem, cursor) : -1;
+            tempo_exec = p->fatia(m, i, tempo_atual, proxima_chegada);
+            if (restante[i] < tempo_exec) {
+                tempo_exec = restante[i];
+            }
+            restante[i] -= tempo_exec;
+        }
+
+        if (tempo_exec > INT_MAX - tempo_atual) {
+            res->estouro_relogio = 1;
+            break;
+        }
+        int tempo_inicio = tempo_atual;
+        tempo_atual += tempo_exec;
+        resultado_registrar_intervalo(res, i, tempo_inicio, tempo_atual);
+        if (p->executou != NULL) {
+            p->executou(m, i, tempo_exec);
+        }
+
+        // Quem chegou durante a fatia entra na fila antes do processo atual voltar
+        // (sem preempção, ninguém volta: as chegadas entram no começo da próxima volta)
+        if (p->preemptiva) {
+            while (motor_ha_chegada(m, fluxo, cursor, n) && motor_proxima_chegada(m, fluxo, processos, ordem, cursor) <= tempo_atual) {
+                p->chegou(m, motor_admitir(p, m, fluxo, ordem, &cursor, &pendentes));
+            }
+            if (fluxo) {
+                processos = m->processos;
+                restante = m->restante;
+            }
+        }
+
+        if (!p->preemptiva || restante[i] == 0) {
+            resultado_registrar_conclusao(res, i, tempo_atual);
+            if (p->concluiu != NULL) {
+                p->concluiu(m, i);
+            }
+            motor_liberar_vaga(m, fluxo, i);
+            pendentes--;
+        } else {
+            p->devolver(m, i);
+            INSTR_DEVOLVIDO(res, i);
+        }
+
+        if (p->tempo_avancou != NULL) {
+            p->tempo_avancou(m, tempo_atual);
+        }
+    }
+
+    INSTR_ENCERRAR_FASE(res, FASE_SIMULACAO);
+}
+
+#endif
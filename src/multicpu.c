@@ -0,0 +1,396 @@
+/**
+ * @file multicpu.c
+ * @brief Motor de eventos da simulação com várias CPUs.
+ *
+ * O estado de cada CPU é o processo em execução e o fim previsto da fatia
+ * atual. Os fins de fatia ficam em um heap de eventos (no máximo um evento
+ * válido por CPU) e as chegadas são lidas em ordem de chegada, então cada
+ * evento custa O(log K) e a simulação não visita instantes ociosos.
+ *
+ * Chegadas no mesmo instante são distribuídas primeiro e só depois as CPUs
+ * afetadas escolhem o que executar, como nas versões de uma CPU. Assim, com
+ * uma CPU, o resultado é idêntico ao de simulador.c.
+ */
+
+#include <stdlib.h>     // malloc, free, abort
+#include <limits.h>     // INT_MAX
+#include "multicpu.h"
+#include "filas.h"      // Heap de mínimo e fila circular usados como filas de prontos
+#include "processos.h"  // ordenar_por_chegada
+
+#define TENTATIVAS_ROUBO 4      // CPUs sorteadas por uma CPU ociosa em busca de trabalho
+
+// Estado de uma CPU
+typedef struct {
+    int atual;                  // Processo em execução (-1 = ociosa)
+    int inicio_fatia;           // Início da execução da fatia atual (após o custo de migração)
+    int fim_fatia;              // Fim previsto da fatia atual
+    int posicao_ociosa;         // Posição na pilha de CPUs ociosas (-1 = não está nela)
+    int tocada;                 // Recebeu processos no lote de chegadas atual
+    FilaCircular fila;          // Fila de prontos (FIFO e Round-Robin)
+    HeapMin heap;               // Fila de prontos (SJF, Prioridade e SRTF)
+} Nucleo;
+
+// Estado completo de uma simulação
+typedef struct {
+    Algoritmo algoritmo;
+    const Processo *processos;
+    int quantum;
+    ConfigMultiCPU config;
+    int usa_heap;               // SJF, Prioridade e SRTF usam heap; FIFO e Round-Robin, fila circular
+    Nucleo *nucleos;
+    int *restante;              // Tempo restante de cada processo
+    int *ultima_cpu;            // Última CPU em que cada processo executou (-1 = nunca executou)
+    HeapMin eventos;            // Fins de fatia: chave = tempo, desempate = CPU
+    int *ociosas;               // Pilha de CPUs ociosas
+    int n_ociosas;
+    int *tocadas;               // CPUs que receberam processos no lote de chegadas atual
+    int n_tocadas;
+    unsigned sorteio;           // Estado do gerador xorshift
+    int concluidos;
+    ResultadoSimulacao *res;
+} SimulacaoMultiCPU;
+
+// Gerador xorshift32: rápido e reprodutível a partir da semente
+static unsigned sortear(SimulacaoMultiCPU *s) {
+    unsigned x = s->sorteio;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s->sorteio = x;
+    return x;
+}
+
+static int tamanho_fila(const SimulacaoMultiCPU *s, const Nucleo *c) {
+    return s->usa_heap ? c->heap.tamanho : c->fila.tamanho;
+}
+
+// Processos na CPU: os da fila mais o que está executando
+static int carga(const SimulacaoMultiCPU *s, const Nucleo *c) {
+    return tamanho_fila(s, c) + (c->atual >= 0);
+}
+
+static void enfileirar(SimulacaoMultiCPU *s, Nucleo *c, int i) {
+    if (s->usa_heap) {
+        const Processo *p = &s->processos[i];
+        int chave = (s->algoritmo == ALGORITMO_SJF)  ? p->tempo_execucao
+                  : (s->algoritmo == ALGORITMO_SRTF) ? s->restante[i]
+                                                     : p->prioridade;
+        heap_inserir(&c->heap, chave, p->pid, i);
+    } else {
+        fila_inserir(&c->fila, i);
+    }
+}
+
+static int desenfileirar(SimulacaoMultiCPU *s, Nucleo *c) {
+    return s->usa_heap ? heap_remover_min(&c->heap).indice : fila_remover(&c->fila);
+}
+
+static void marcar_ociosa(SimulacaoMultiCPU *s, int cpu) {
+    if (s->nucleos[cpu].posicao_ociosa < 0) {
+        s->nucleos[cpu].posicao_ociosa = s->n_ociosas;
+        s->ociosas[s->n_ociosas++] = cpu;
+    }
+}
+
+// Tira a CPU da pilha de ociosas trocando-a com a do topo - O(1)
+static void desmarcar_ociosa(SimulacaoMultiCPU *s, int cpu) {
+    int pos = s->nucleos[cpu].posicao_ociosa;
+    if (pos < 0) {
+        return;
+    }
+    int topo = s->ociosas[--s->n_ociosas];
+    s->ociosas[pos] = topo;
+    s->nucleos[topo].posicao_ociosa = pos;
+    s->nucleos[cpu].posicao_ociosa = -1;
+}
+
+// Procura trabalho na fila de outras CPUs; retorna o processo roubado ou -1
+static int roubar(SimulacaoMultiCPU *s, int cpu, int vitima) {
+    int k = s->config.n_cpus;
+
+    // Vítima sugerida (quem acabou de receber trabalho) ou CPUs sorteadas
+    for (int tentativa = 0; tentativa <= TENTATIVAS_ROUBO; tentativa++) {
+        int v = (tentativa == 0) ? vitima : (int)(sortear(s) % (unsigned)k);
+        if (v < 0 || v == cpu || tamanho_fila(s, &s->nucleos[v]) == 0) {
+            continue;
+        }
+        s->res->n_roubos++;
+        return desenfileirar(s, &s->nucleos[v]);
+    }
+    return -1;
+}
+
+// Escolhe o que a CPU executa a partir do tempo t (fila própria, depois roubo)
+// Processos sem tempo de execução terminam na hora e a escolha continua
+static void despachar(SimulacaoMultiCPU *s, int cpu, int t, int vitima) {
+    Nucleo *c = &s->nucleos[cpu];
+
+    for (;;) {
+        int i = -1;
+        if (tamanho_fila(s, c) > 0) {
+            i = desenfileirar(s, c);
+        } else if (s->config.roubo && s->config.n_cpus > 1) {
+            i = roubar(s, cpu, vitima);
+        }
+
+        if (i < 0) {
+            c->atual = -1;
+            marcar_ociosa(s, cpu);
+            return;
+        }
+        desmarcar_ociosa(s, cpu);
+        INSTR_DECISAO(s->res, i, tamanho_fila(s, c) + 1);
+
+        // Voltar a executar em outra CPU custa o tempo de migração
+        long long inicio_longo = t;
+        if (s->ultima_cpu[i] >= 0 && s->ultima_cpu[i] != cpu) {
+            inicio_longo += s->config.custo_migracao;
+            s->res->n_migracoes++;
+        }
+        int duracao = s->restante[i];
+        if (s->algoritmo == ALGORITMO_ROUND_ROBIN && duracao > s->quantum) {
+            duracao = s->quantum;
+        }
+        if (inicio_longo + duracao > INT_MAX) {
+            s->res->estouro_relogio = 1;    // O relógio passaria de INT_MAX: a simulação para
+            c->atual = -1;
+            return;
+        }
+        int inicio = (int)inicio_longo;
+
+        if (s->restante[i] == 0) {
+            resultado_registrar_intervalo_cpu(s->res, cpu, i, inicio, inicio);
+            resultado_registrar_conclusao(s->res, i, inicio);
+            s->ultima_cpu[i] = cpu;
+            s->concluidos++;
+            t = inicio;
+            continue;
+        }
+
+        c->atual = i;
+        c->inicio_fatia = inicio;
+        c->fim_fatia = inicio + duracao;
+        heap_inserir(&s->eventos, c->fim_fatia, cpu, cpu);
+        return;
+    }
+}
+
+// Uma CPU ociosa, se houver, tenta roubar da CPU que acabou de ganhar fila
+static void acordar_ociosa(SimulacaoMultiCPU *s, int cpu, int t) {
+    if (s->config.roubo && s->n_ociosas > 0 && tamanho_fila(s, &s->nucleos[cpu]) > 0) {
+        despachar(s, s->ociosas[s->n_ociosas - 1], t, cpu);
+    }
+}
+
+// Encerra a fatia em execução na CPU no tempo t (fim previsto ou preempção)
+// O processo termina ou volta para a fila da mesma CPU
+static void encerrar_fatia(SimulacaoMultiCPU *s, int cpu, int t) {
+    Nucleo *c = &s->nucleos[cpu];
+    int i = c->atual;
+    int executado = t - c->inicio_fatia;    // Negativo se interrompido durante a migração
+
+    c->atual = -1;
+    if (executado > 0) {
+        resultado_registrar_intervalo_cpu(s->res, cpu, i, c->inicio_fatia, t);
+        s->restante[i] -= executado;
+        s->ultima_cpu[i] = cpu;
+    }
+
+    if (s->restante[i] == 0) {
+        resultado_registrar_conclusao(s->res, i, t);
+        s->concluidos++;
+    } else {
+        enfileirar(s, c, i);
+        INSTR_DEVOLVIDO(s->res, i);     // A próxima decisão é desta mesma CPU (ver despachar)
+    }
+}
+
+// Verdadeiro se o primeiro da fila da CPU deve tomar o lugar do processo em execução no tempo t
+static int deve_preemptar(const SimulacaoMultiCPU *s, const Nucleo *c, int t) {
+    if ((s->algoritmo != ALGORITMO_PRIORIDADE && s->algoritmo != ALGORITMO_SRTF) ||
+        c->atual < 0 || c->heap.tamanho == 0) {
+        return 0;
+    }
+    const Processo *p = &s->processos[c->atual];
+    const ItemHeap *topo = &c->heap.itens[0];
+    int chave = p->prioridade;
+    if (s->algoritmo == ALGORITMO_SRTF) {
+        // Tempo que ainda falta ao processo atual (nada executado durante a migração)
+        chave = s->restante[c->atual] - (t > c->inicio_fatia ? t - c->inicio_fatia : 0);
+    }
+    return topo->chave < chave || (topo->chave == chave && topo->pid < p->pid);
+}
+
+// Coloca o processo que chegou na menos carregada de duas CPUs sorteadas
+static void distribuir_chegada(SimulacaoMultiCPU *s, int i) {
+    int k = s->config.n_cpus;
+    int cpu = 0;
+    if (k > 1) {
+        int a = (int)(sortear(s) % (unsigned)k);
+        int b = (int)(sortear(s) % (unsigned)k);
+        cpu = (carga(s, &s->nucleos[b]) < carga(s, &s->nucleos[a])) ? b : a;
+    }
+
+    Nucleo *c = &s->nucleos[cpu];
+    enfileirar(s, c, i);
+    if (!c->tocada) {
+        c->tocada = 1;
+        s->tocadas[s->n_tocadas++] = cpu;
+    }
+}
+
+// Depois de um lote de chegadas, cada CPU afetada decide o que executar
+static void processar_tocadas(SimulacaoMultiCPU *s, int t) {
+    for (int k = 0; k < s->n_tocadas; k++) {
+        int cpu = s->tocadas[k];
+        Nucleo *c = &s->nucleos[cpu];
+        c->tocada = 0;
+
+        if (c->atual < 0) {
+            despachar(s, cpu, t, -1);
+        } else if (deve_preemptar(s, c, t)) {
+            encerrar_fatia(s, cpu, t);
+            despachar(s, cpu, t, -1);
+        }
+        acordar_ociosa(s, cpu, t);
+    }
+    s->n_tocadas = 0;
+}
+
+void multicpu_config_padrao(ConfigMultiCPU *config) {
+    config->n_cpus = 1;
+    config->roubo = 0;
+    config->custo_migracao = 0;
+    config->semente = 1;
+}
+
+int multicpu_suporta(Algoritmo algoritmo) {
+    return algoritmo == ALGORITMO_FIFO || algoritmo == ALGORITMO_SJF ||
+           algoritmo == ALGORITMO_ROUND_ROBIN || algoritmo == ALGORITMO_PRIORIDADE ||
+           algoritmo == ALGORITMO_SRTF;
+}
+
+void simular_multicpu(Algoritmo algoritmo, const Processo *lista_processos, int n, const int *ordem_chegada,
+                      int quantum, const ConfigMultiCPU *config, ResultadoSimulacao *res) {
+    SimulacaoMultiCPU s;
+    int *ordem_alocada = NULL;
+    const int *ordem = ordem_chegada;
+
+    if (ordem == NULL) {
+        ordem_alocada = malloc((n > 0 ? n : 1) * sizeof(int));
+        if (ordem_alocada == NULL) {
+            abort();            // Sem memória não há como continuar a simulação
+        }
+        ordenar_por_chegada(lista_processos, n, ordem_alocada);
+        ordem = ordem_alocada;
+    }
+
+    s.algoritmo = algoritmo;
+    s.processos = lista_processos;
+    s.quantum = quantum < 1 ? 1 : quantum;
+    s.config = *config;
+    if (s.config.n_cpus < 1) {
+        s.config.n_cpus = 1;
+    }
+    if (s.config.n_cpus > MAX_CPUS) {
+        s.config.n_cpus = MAX_CPUS;
+    }
+    if (s.config.custo_migracao < 0) {
+        s.config.custo_migracao = 0;
+    }
+    s.usa_heap = (algoritmo == ALGORITMO_SJF || algoritmo == ALGORITMO_PRIORIDADE ||
+                  algoritmo == ALGORITMO_SRTF);
+    s.sorteio = s.config.semente ? s.config.semente : 1;    // xorshift não pode começar em 0
+    s.concluidos = 0;
+    s.res = res;
+
+    int k = s.config.n_cpus;
+    s.nucleos = malloc(k * sizeof(Nucleo));
+    s.ociosas = malloc(k * sizeof(int));
+    s.tocadas = malloc(k * sizeof(int));
+    s.restante = malloc((n > 0 ? n : 1) * sizeof(int));
+    s.ultima_cpu = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (s.nucleos == NULL || s.ociosas == NULL || s.tocadas == NULL || s.restante == NULL || s.ultima_cpu == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    s.n_ociosas = 0;
+    s.n_tocadas = 0;
+    heap_inicializar(&s.eventos, k);
+
+    for (int c = 0; c < k; c++) {
+        Nucleo *nc = &s.nucleos[c];
+        nc->atual = -1;
+        nc->posicao_ociosa = -1;
+        nc->tocada = 0;
+        if (s.usa_heap) {
+            heap_inicializar(&nc->heap, 16);
+        } else {
+            fila_inicializar(&nc->fila, 16);
+        }
+        marcar_ociosa(&s, c);
+    }
+    for (int i = 0; i < n; i++) {
+        s.restante[i] = lista_processos[i].tempo_execucao;
+        s.ultima_cpu[i] = -1;
+    }
+
+    resultado_preparar(res, algoritmo, lista_processos, n);
+    resultado_definir_cpus(res, k);
+    if (algoritmo == ALGORITMO_ROUND_ROBIN) {
+        res->quantum = s.quantum;
+    }
+
+    int cursor = 0;         // Próximo processo (na ordem de chegada) que ainda não chegou
+    int tempo_atual = 0;    // Relógio global
+
+    INSTR_INICIAR_FASE(res, FASE_SIMULACAO);
+    while (s.concluidos < n && !res->estouro_relogio && !resultado_interrompido(res, tempo_atual)) {
+        int proxima_chegada = (cursor < n) ? lista_processos[ordem[cursor]].tempo_chegada : INT_MAX;
+
+        // Chegadas vêm antes dos fins de fatia no mesmo instante (como no Round-Robin de uma CPU)
+        if (cursor < n && (s.eventos.tamanho == 0 || proxima_chegada <= s.eventos.itens[0].chave)) {
+            if (s.n_ociosas == k && proxima_chegada > tempo_atual) {
+                INSTR_SALTO_OCIOSO(res);
+            }
+            tempo_atual = proxima_chegada;
+            while (cursor < n && lista_processos[ordem[cursor]].tempo_chegada == tempo_atual) {
+                distribuir_chegada(&s, ordem[cursor++]);
+            }
+            processar_tocadas(&s, tempo_atual);
+            continue;
+        }
+        if (s.eventos.tamanho == 0) {
+            break;          // Nada mais a fazer (não deveria ocorrer)
+        }
+
+        ItemHeap evento = heap_remover_min(&s.eventos);
+        int cpu = evento.indice;
+        Nucleo *c = &s.nucleos[cpu];
+        tempo_atual = evento.chave;
+
+        // Eventos de fatias interrompidas por preempção ficam no heap e são ignorados aqui
+        if (c->atual < 0 || c->fim_fatia != tempo_atual) {
+            continue;
+        }
+        encerrar_fatia(&s, cpu, tempo_atual);
+        despachar(&s, cpu, tempo_atual, -1);
+        acordar_ociosa(&s, cpu, tempo_atual);
+    }
+    INSTR_ENCERRAR_FASE(res, FASE_SIMULACAO);
+
+    for (int c = 0; c < k; c++) {
+        if (s.usa_heap) {
+            heap_liberar(&s.nucleos[c].heap);
+        } else {
+            fila_liberar(&s.nucleos[c].fila);
+        }
+    }
+    heap_liberar(&s.eventos);
+    free(s.nucleos);
+    free(s.ociosas);
+    free(s.tocadas);
+    free(s.restante);
+    free(s.ultima_cpu);
+    free(ordem_alocada);
+}
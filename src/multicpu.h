@@ -0,0 +1,44 @@
+/**
+ * @file multicpu.h
+ * @brief Simulação dos algoritmos de escalonamento em várias CPUs.
+ *
+ * Cada CPU tem sua própria fila de prontos (FIFO, SJF, Round-Robin,
+ * Prioridade ou SRTF, como em simulador.h). Um relógio global de eventos ordena os
+ * fins de fatia de todas as CPUs e as chegadas de processos. Cada processo
+ * que chega vai para a menos carregada de duas CPUs sorteadas ("power of two
+ * choices"). Com o roubo de trabalho ativo, uma CPU que fica ociosa tira
+ * processos da fila de outras CPUs. Um processo que volta a executar em uma
+ * CPU diferente da última paga o custo de migração antes de executar.
+ */
+
+#ifndef MULTICPU_H            // Evita inclusão duplicada
+#define MULTICPU_H
+
+#include "processos.h"        // Definição da struct Processo
+#include "resultado.h"        // Resultado estruturado (métricas, intervalos e uso de cada CPU)
+
+// Maior quantidade de CPUs simuladas
+#define MAX_CPUS 65536
+
+// Parâmetros da simulação com várias CPUs
+typedef struct {
+    int n_cpus;               // Quantidade de CPUs (valores < 1 são tratados como 1 e > MAX_CPUS como MAX_CPUS)
+    int roubo;                // Diferente de 0: CPUs ociosas roubam processos de outras filas
+    int custo_migracao;       // Tempo perdido quando um processo volta a executar em outra CPU
+    unsigned semente;         // Semente do sorteio de CPUs (mesma semente = mesma simulação)
+} ConfigMultiCPU;
+
+// Valores padrão: 1 CPU, sem roubo, sem custo de migração, semente 1
+void multicpu_config_padrao(ConfigMultiCPU *config);
+
+// Verdadeiro se o algoritmo pode ser simulado com várias CPUs (FIFO, SJF, Round-Robin, Prioridade e SRTF)
+int multicpu_suporta(Algoritmo algoritmo);
+
+// Simula o algoritmo indicado em config->n_cpus CPUs
+// Demais parâmetros seguem simular_algoritmo (simulador.h)
+// Com uma CPU, o resultado é igual ao da simulação correspondente de simulador.h
+// Aborta se faltar memória, como o crescimento das filas (filas.h)
+void simular_multicpu(Algoritmo algoritmo, const Processo *lista_processos, int n, const int *ordem_chegada,
+                      int quantum, const ConfigMultiCPU *config, ResultadoSimulacao *res);
+
+#endif
@@ -0,0 +1,162 @@
+/**
+ * @file paralelo.c
+ * @brief Implementação do conjunto de threads com roubo de trabalho.
+ *
+ * Cada thread guarda a faixa [inicio, fim) de tarefas pendentes, protegida
+ * por um mutex próprio: a dona só disputa o mutex com ladrões, que são raros.
+ * Como nenhuma tarefa nova é criada, uma thread que não encontra nada para
+ * roubar em nenhuma outra pode terminar.
+ */
+
+#include <stdlib.h>     // malloc, free
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>    // GetSystemInfo
+#else
+#include <unistd.h>     // sysconf
+#endif
+#include "paralelo.h"
+
+// Tarefas pendentes de uma thread
+typedef struct {
+    pthread_mutex_t trava;
+    int inicio;                 // Próxima tarefa da própria thread
+    int fim;                    // Fim (exclusivo) da faixa; ladrões tiram daqui
+} FaixaTarefas;
+
+// Estado compartilhado por todas as threads de uma execução
+typedef struct {
+    FaixaTarefas *faixas;
+    int n_trabalhadores;
+    FuncaoTarefa executar;
+    void *contexto;
+} ConjuntoThreads;
+
+// Argumento de cada thread
+typedef struct {
+    ConjuntoThreads *conjunto;
+    int indice;
+} Trabalhador;
+
+int numero_de_nucleos(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+// Tira a próxima tarefa da própria faixa; retorna -1 se ela estiver vazia
+static int pegar_propria(FaixaTarefas *faixa) {
+    int tarefa = -1;
+    pthread_mutex_lock(&faixa->trava);
+    if (faixa->inicio < faixa->fim) {
+        tarefa = faixa->inicio++;
+    }
+    pthread_mutex_unlock(&faixa->trava);
+    return tarefa;
+}
+
+// Rouba a metade final da faixa da primeira thread com trabalho, a partir da vizinha
+// Retorna 1 se a própria faixa recebeu tarefas
+static int roubar(ConjuntoThreads *c, int ladrao) {
+    for (int k = 1; k < c->n_trabalhadores; k++) {
+        FaixaTarefas *vitima = &c->faixas[(ladrao + k) % c->n_trabalhadores];
+        int inicio = 0, fim = 0;
+
+        pthread_mutex_lock(&vitima->trava);
+        int restantes = vitima->fim - vitima->inicio;
+        if (restantes > 0) {
+            int metade = (restantes + 1) / 2;   // Com uma tarefa só, leva ela
+            fim = vitima->fim;
+            inicio = fim - metade;
+            vitima->fim = inicio;
+        }
+        pthread_mutex_unlock(&vitima->trava);
+
+        if (fim > inicio) {
+            FaixaTarefas *propria = &c->faixas[ladrao];
+            pthread_mutex_lock(&propria->trava);
+            propria->inicio = inicio;
+            propria->fim = fim;
+            pthread_mutex_unlock(&propria->trava);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void* executar_trabalhador(void *argumento) {
+    Trabalhador *t = argumento;
+    ConjuntoThreads *c = t->conjunto;
+
+    for (;;) {
+        int tarefa = pegar_propria(&c->faixas[t->indice]);
+        if (tarefa < 0) {
+            if (!roubar(c, t->indice)) {
+                break;          // Nada pendente em nenhuma faixa
+            }
+            continue;
+        }
+        c->executar(c->contexto, tarefa, t->indice);
+    }
+    return NULL;
+}
+
+int executar_em_paralelo(int n_tarefas, int n_trabalhadores, FuncaoTarefa executar, void *contexto) {
+    if (n_trabalhadores > n_tarefas) {
+        n_trabalhadores = n_tarefas;
+    }
+    if (n_trabalhadores <= 1) {
+        for (int i = 0; i < n_tarefas; i++) {
+            executar(contexto, i, 0);
+        }
+        return 1;
+    }
+
+    ConjuntoThreads c;
+    c.n_trabalhadores = n_trabalhadores;
+    c.executar = executar;
+    c.contexto = contexto;
+    c.faixas = malloc(n_trabalhadores * sizeof(FaixaTarefas));
+    Trabalhador *trabalhadores = malloc(n_trabalhadores * sizeof(Trabalhador));
+    pthread_t *threads = malloc(n_trabalhadores * sizeof(pthread_t));
+    if (c.faixas == NULL || trabalhadores == NULL || threads == NULL) {
+        free(c.faixas);
+        free(trabalhadores);
+        free(threads);
+        return 0;
+    }
+
+    // Faixas contíguas iniciais de tamanhos iguais
+    for (int w = 0; w < n_trabalhadores; w++) {
+        pthread_mutex_init(&c.faixas[w].trava, NULL);
+        c.faixas[w].inicio = (int)((long long)n_tarefas * w / n_trabalhadores);
+        c.faixas[w].fim = (int)((long long)n_tarefas * (w + 1) / n_trabalhadores);
+        trabalhadores[w].conjunto = &c;
+        trabalhadores[w].indice = w;
+    }
+
+    // A thread atual trabalha como a de índice 0
+    // Se uma thread não puder ser criada, as demais roubam a faixa que ficaria sem dona
+    int criadas = 1;
+    while (criadas < n_trabalhadores &&
+           pthread_create(&threads[criadas], NULL, executar_trabalhador, &trabalhadores[criadas]) == 0) {
+        criadas++;
+    }
+    executar_trabalhador(&trabalhadores[0]);
+    for (int w = 1; w < criadas; w++) {
+        pthread_join(threads[w], NULL);
+    }
+
+    for (int w = 0; w < n_trabalhadores; w++) {
+        pthread_mutex_destroy(&c.faixas[w].trava);
+    }
+    free(c.faixas);
+    free(trabalhadores);
+    free(threads);
+    return 1;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file paralelo.h
+ * @brief Execução de tarefas independentes em várias threads, com roubo de trabalho.
+ *
+ * As tarefas 0..n-1 são divididas em faixas contíguas, uma por thread. Cada
+ * thread consome sua faixa pelo início; quando ela acaba, rouba a metade final
+ * da faixa de outra thread. Tarefas de durações muito diferentes (n pequeno e
+ * n grande, quantum 1 e quantum 100) ficam assim bem distribuídas sem um
+ * contador global disputado a cada tarefa.
+ */
+
+#ifndef PARALELO_H            // Evita inclusão duplicada
+#define PARALELO_H
+
+// Função executada para cada tarefa
+// - contexto: o ponteiro passado para executar_em_paralelo
+// - tarefa: índice da tarefa (0 a n_tarefas-1); cada índice é executado uma única vez
+// - trabalhador: índice da thread (0 a n_trabalhadores-1), para usar memória própria da thread
+typedef void (*FuncaoTarefa)(void *contexto, int tarefa, int trabalhador);
+
+// Quantidade de núcleos disponíveis (pelo menos 1)
+int numero_de_nucleos(void);
+
+// Executa as tarefas em n_trabalhadores threads e retorna quando todas terminarem
+// Com n_trabalhadores <= 1, executa tudo na thread atual, em ordem
+// Retorna 0 se faltar memória (nesse caso nada é executado); se alguma thread
+// não puder ser criada, as outras executam as tarefas que seriam dela
+int executar_em_paralelo(int n_tarefas, int n_trabalhadores, FuncaoTarefa executar, void *contexto);
+
+#endif
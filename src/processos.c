@@ -6,71 +6,297 @@
  * além de alocar e desalocar memória.
  * Essas funções são utilizadas pela interface gráfica e pelos algoritmos.
  *
+ * A lista cresce dobrando de capacidade e mantém uma tabela hash
+ * (endereçamento aberto, sondagem linear) do PID para a posição no vetor,
+ * então inserção, busca e remoção custam O(1) amortizado. A ordem por chegada
+ * usada pelos algoritmos fica em cache e só é refeita quando a lista muda.
+ *
  * @author Carolina Mafra Sada, Amanda Victória Almeida Silva
  */
 
+#include <limits.h>               // INT_MAX
+#include <stdint.h>               // uint64_t para as chaves do radix sort
 #include <stdlib.h>               // Biblioteca padrão para funções como malloc, realloc, free
+#include <string.h>               // memset
 #include "processos.h"           // Header com a definição da struct Processo
 
+// Posição inicial de um PID na tabela (hash multiplicativo)
+static int posicao_hash(int pid, int capacidade_tabela) {
+    return (int)(((unsigned)pid * 2654435761u) & (unsigned)(capacidade_tabela - 1));
+}
+
+// Procura a posição da tabela que contém o PID (ou a posição livre onde ele entraria)
+static int sondar(const ListaProcessos *lista, int pid) {
+    int mascara = lista->capacidade_tabela - 1;
+    int pos = posicao_hash(pid, lista->capacidade_tabela);
+    while (lista->tabela[pos] != -1 && lista->itens[lista->tabela[pos]].pid != pid) {
+        pos = (pos + 1) & mascara;
+    }
+    return pos;
+}
+
+// Reconstrói a tabela com a capacidade informada (potência de 2)
+// Retorna 1 se deu certo, 0 se há PIDs repetidos e -1 se faltou memória
+static int reconstruir_tabela(ListaProcessos *lista, int capacidade_tabela) {
+    int *nova = malloc(capacidade_tabela * sizeof(int));
+    if (nova == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < capacidade_tabela; i++) {
+        nova[i] = -1;
+    }
+
+    free(lista->tabela);
+    lista->tabela = nova;
+    lista->capacidade_tabela = capacidade_tabela;
+
+    for (int i = 0; i < lista->n; i++) {
+        int pos = sondar(lista, lista->itens[i].pid);
+        if (lista->tabela[pos] != -1) {
+            return 0;             // PID repetido
+        }
+        lista->tabela[pos] = i;
+    }
+    return 1;
+}
+
+// Garante espaço para mais um processo no vetor e na tabela (fator de carga <= 1/2)
+static int garantir_capacidade(ListaProcessos *lista, int necessario) {
+    if (necessario > lista->capacidade) {
+        int nova = lista->capacidade ? lista->capacidade : 16;
+        while (nova < necessario) nova *= 2;
+
+        Processo *temp = realloc(lista->itens, nova * sizeof(Processo));
+        if (temp == NULL) {
+            return 0;             // Falha na alocação, mantém a lista original
+        }
+        lista->itens = temp;
+        lista->capacidade = nova;
+    }
+
+    if (2 * necessario > lista->capacidade_tabela) {
+        int nova = lista->capacidade_tabela ? lista->capacidade_tabela : 32;
+        while (nova < 2 * necessario) nova *= 2;
+        return reconstruir_tabela(lista, nova) > 0;   // Os PIDs da lista já são distintos
+    }
+    return 1;
+}
+
+void inicializar_lista(ListaProcessos *lista) {
+    lista->itens = NULL;
+    lista->n = 0;
+    lista->capacidade = 0;
+    lista->tabela = NULL;
+    lista->capacidade_tabela = 0;
+    lista->proximo_pid = 1;
+    lista->ordem = NULL;
+    lista->ordem_valida = 0;
+}
+
+// Avança o PID sugerido para depois de `pid` (fica em INT_MAX em vez de dar a volta)
+static void avancar_proximo_pid(ListaProcessos *lista, int pid) {
+    if (pid >= lista->proximo_pid) {
+        lista->proximo_pid = pid < INT_MAX ? pid + 1 : INT_MAX;
+    }
+}
+
 // Função para inserir um novo processo na lista
-// - lista: ponteiro para o vetor de processos atual
-// - n: ponteiro para a quantidade de processos
+// - lista: lista de processos
 // - novo: struct Processo a ser inserido
-Processo* inserir_processo(Processo *lista, int *n, Processo novo) {
-    // Realoca memória para adicionar mais um processo à lista
-    Processo *temp = realloc(lista, (*n + 1) * sizeof(Processo));
-    if (temp == NULL) {
-        // Falha na alocação, mantém a lista original
-        return lista;
+int inserir_processo(ListaProcessos *lista, Processo novo) {
+    if (!garantir_capacidade(lista, lista->n + 1)) {
+        return 0;
     }
-    lista = temp;              // Atualiza o ponteiro da lista com o novo espaço realocado
-    lista[*n] = novo;          // Insere o novo processo na última posição da lista
-    (*n)++;                    // Incrementa o contador de processos
-    return lista;              // Retorna a nova lista
+
+    int pos = sondar(lista, novo.pid);
+    if (lista->tabela[pos] != -1) {
+        return 0;                 // Já existe um processo com esse PID
+    }
+
+    lista->itens[lista->n] = novo;     // Insere o novo processo na última posição da lista
+    lista->tabela[pos] = lista->n;
+    lista->n++;                        // Incrementa o contador de processos
+    lista->ordem_valida = 0;           // A ordem por chegada precisa ser refeita
+
+    avancar_proximo_pid(lista, novo.pid);
+    return 1;
 }
 
-// Função para reinicializar a lista de processos (liberar memória e zerar contagem)
-void reinicializar_lista(Processo **lista, int *n) {
-    if (*lista != NULL) {      // Se a lista não for nula, libera a memória alocada
-        free(*lista);          // Libera a memória da lista
-        *lista = NULL;         // Define o ponteiro como NULL para evitar uso indevido
+int buscar_processo(const ListaProcessos *lista, int pid) {
+    if (lista->n == 0) {
+        return -1;
     }
-    *n = 0;                    // Reseta o contador de processos
+    return lista->tabela[sondar(lista, pid)];
 }
 
 // Função para remover um processo da lista com base no PID
-// - lista: vetor de processos
-// - n: ponteiro para o número de processos
+// - lista: lista de processos
 // - pid: identificador do processo a ser removido
-Processo* remover_processo(Processo *lista, int *n, int pid) {
-    int i, pos = -1;           // Inicializa variáveis: índice do laço e posição do processo a remover
-
-    // Encontrar índice do processo com pid
-    for (i = 0; i < *n; i++) {
-        if (lista[i].pid == pid) {
-            pos = i;           // Armazena o índice quando o processo é encontrado
-            break;             // Interrompe o laço após encontrar
+int remover_processo(ListaProcessos *lista, int pid) {
+    if (lista->n == 0) {
+        return 0;
+    }
+
+    int mascara = lista->capacidade_tabela - 1;
+    int pos = sondar(lista, pid);
+    int indice = lista->tabela[pos];
+    if (indice == -1) {
+        return 0;                 // Processo não encontrado
+    }
+
+    // Remove a entrada da tabela deslocando para trás as entradas seguintes
+    // do mesmo agrupamento (mantém a sondagem linear correta sem marcadores)
+    int livre = pos;
+    int atual = (pos + 1) & mascara;
+    while (lista->tabela[atual] != -1) {
+        int ideal = posicao_hash(lista->itens[lista->tabela[atual]].pid, lista->capacidade_tabela);
+        // A entrada pode ir para `livre` se `livre` está entre sua posição ideal e a atual
+        if (((atual - ideal) & mascara) >= ((atual - livre) & mascara)) {
+            lista->tabela[livre] = lista->tabela[atual];
+            livre = atual;
         }
+        atual = (atual + 1) & mascara;
     }
+    lista->tabela[livre] = -1;
 
-    if (pos == -1) {
-        // Processo não encontrado, retorna lista sem mudanças
-        return lista;
+    // O último processo ocupa a posição do removido
+    int ultimo = lista->n - 1;
+    if (indice != ultimo) {
+        lista->itens[indice] = lista->itens[ultimo];
+        lista->tabela[sondar(lista, lista->itens[indice].pid)] = indice;
+    }
+    lista->n--;                   // Decrementa o número total de processos
+    lista->ordem_valida = 0;
+    return 1;
+}
+
+int substituir_lista(ListaProcessos *lista, Processo *vetor, int n) {
+    reinicializar_lista(lista);
+    lista->itens = vetor;
+    lista->n = n;
+    lista->capacidade = n;
+
+    int capacidade_tabela = 32;
+    while (capacidade_tabela < 2 * n) capacidade_tabela *= 2;
+    int status = reconstruir_tabela(lista, capacidade_tabela);
+    if (status <= 0) {
+        reinicializar_lista(lista);
+        return status;
+    }
+
+    for (int i = 0; i < n; i++) {
+        avancar_proximo_pid(lista, vetor[i].pid);
+    }
+    return 1;
+}
+
+// Dígitos de 11 bits: 6 passadas cobrem a chave de 64 bits e o histograma cabe no cache
+#define BITS_RADIX 11
+#define BALDES_RADIX (1 << BITS_RADIX)
+
+// Verdadeiro se o processo a vem antes do b na ordem de chegada (desempate pelo PID)
+static int chega_antes(const Processo *a, const Processo *b) {
+    if (a->tempo_chegada != b->tempo_chegada) return a->tempo_chegada < b->tempo_chegada;
+    return a->pid < b->pid;
+}
+
+// Ordenação por inserção direta, usada para listas pequenas
+static void ordenar_por_insercao(const Processo *lista, int n, int *ordem) {
+    for (int i = 0; i < n; i++) {
+        int j = i;
+        while (j > 0 && chega_antes(&lista[i], &lista[ordem[j - 1]])) {
+            ordem[j] = ordem[j - 1];
+            j--;
+        }
+        ordem[j] = i;
+    }
+}
+
+// Ordenação por radix sort (LSD) de chaves de 64 bits: chegada nos 32 bits altos e PID
+// nos baixos, ambos deslocados para sem sinal. Cada passada ordena um dígito de forma
+// estável; passadas em que todas as chaves têm o mesmo dígito são puladas.
+void ordenar_por_chegada(const Processo *lista, int n, int *ordem) {
+    // Poucos processos: inserção direta é mais rápida que montar os histogramas
+    if (n < 64) {
+        ordenar_por_insercao(lista, n, ordem);
+        return;
+    }
+
+    uint64_t *chaves = malloc(2 * (size_t)n * sizeof(uint64_t));
+    int *indices_aux = malloc((size_t)n * sizeof(int));
+    if (chaves == NULL || indices_aux == NULL) {
+        free(chaves);
+        free(indices_aux);
+        ordenar_por_insercao(lista, n, ordem);  // Sem memória extra: mais lento, mas correto
+        return;
     }
 
-    // Deslocar os processos após o removido
-    for (i = pos; i < *n - 1; i++) {
-        lista[i] = lista[i + 1];
+    uint64_t *chave_origem = chaves, *chave_destino = chaves + n;
+    int *indice_origem = ordem, *indice_destino = indices_aux;
+
+    for (int i = 0; i < n; i++) {
+        chave_origem[i] = ((uint64_t)((uint32_t)lista[i].tempo_chegada ^ 0x80000000u) << 32) |
+                          ((uint32_t)lista[i].pid ^ 0x80000000u);
+        indice_origem[i] = i;
+    }
+
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += BITS_RADIX) {
+        size_t contagem[BALDES_RADIX];
+        memset(contagem, 0, sizeof(contagem));
+
+        for (int i = 0; i < n; i++) {
+            contagem[(chave_origem[i] >> deslocamento) & (BALDES_RADIX - 1)]++;
+        }
+        if (contagem[(chave_origem[0] >> deslocamento) & (BALDES_RADIX - 1)] == (size_t)n) {
+            continue;             // Todas as chaves têm esse dígito igual: nada a fazer
+        }
+
+        // Converte a contagem em posições iniciais de cada balde
+        size_t soma = 0;
+        for (int b = 0; b < BALDES_RADIX; b++) {
+            size_t c = contagem[b];
+            contagem[b] = soma;
+            soma += c;
+        }
+
+        for (int i = 0; i < n; i++) {
+            size_t destino = contagem[(chave_origem[i] >> deslocamento) & (BALDES_RADIX - 1)]++;
+            chave_destino[destino] = chave_origem[i];
+            indice_destino[destino] = indice_origem[i];
+        }
+
+        // Troca os papéis dos vetores para a próxima passada
+        uint64_t *tc = chave_origem; chave_origem = chave_destino; chave_destino = tc;
+        int *ti = indice_origem; indice_origem = indice_destino; indice_destino = ti;
     }
 
-    (*n)--;                    // Decrementa o número total de processos
+    // Número ímpar de passadas: o resultado ficou no vetor auxiliar
+    if (indice_origem != ordem) {
+        memcpy(ordem, indice_origem, (size_t)n * sizeof(int));
+    }
+    free(chaves);
+    free(indices_aux);
+}
 
-    // Realoca para tamanho menor
-    Processo *temp = realloc(lista, (*n) * sizeof(Processo));
-    if (temp == NULL && *n > 0) {
-        // Falha em realocar, mantém a lista original
-        return lista;
+const int* ordem_por_chegada(ListaProcessos *lista) {
+    if (lista->ordem_valida) {
+        return lista->ordem;
     }
 
-    return temp;               // Retorna a nova lista (ou NULL se n == 0)
+    int *temp = realloc(lista->ordem, (lista->capacidade > 0 ? lista->capacidade : 1) * sizeof(int));
+    if (temp == NULL) {
+        return NULL;
+    }
+    lista->ordem = temp;
+    ordenar_por_chegada(lista->itens, lista->n, lista->ordem);
+    lista->ordem_valida = 1;
+    return lista->ordem;
+}
+
+// Função para reinicializar a lista de processos (liberar memória e zerar contagem)
+void reinicializar_lista(ListaProcessos *lista) {
+    free(lista->itens);        // Libera a memória da lista
+    free(lista->tabela);
+    free(lista->ordem);
+    inicializar_lista(lista);  // Zera os campos para evitar uso indevido
 }
@@ -17,23 +17,53 @@ typedef struct {
     int prioridade;               // Nível de prioridade (menor valor = maior prioridade)
 } Processo;
 
+// Lista de processos com crescimento geométrico e busca por PID em O(1)
+// A ordem dos itens não é preservada na remoção: os algoritmos ordenam por chegada/PID
+typedef struct {
+    Processo *itens;              // Vetor de processos
+    int n;                        // Quantidade de processos na lista
+    int capacidade;               // Capacidade alocada de `itens`
+    int *tabela;                  // Tabela hash PID -> índice em `itens` (-1 = posição livre)
+    int capacidade_tabela;        // Tamanho da tabela (potência de 2)
+    int proximo_pid;              // PID sugerido para o próximo processo (maior PID + 1, no máximo INT_MAX)
+    int *ordem;                   // Cache dos índices em ordem de chegada (ver ordem_por_chegada)
+    int ordem_valida;             // 0 quando a lista mudou depois que o cache foi montado
+} ListaProcessos;
+
+// Inicializa uma lista vazia
+void inicializar_lista(ListaProcessos *lista);
+
 // Declaração da função que insere um novo processo na lista
-// - lista: vetor atual de processos
-// - n: ponteiro para o número atual de processos
+// - lista: lista de processos
 // - novo: struct do novo processo a ser adicionado
-// Retorna: ponteiro para a nova lista atualizada
-Processo* inserir_processo(Processo *lista, int *n, Processo novo);
+// Retorna: 1 se inseriu, 0 se o PID já existe ou faltou memória
+int inserir_processo(ListaProcessos *lista, Processo novo);
 
 // Declaração da função que remove um processo com base no PID
-// - lista: vetor atual de processos
-// - n: ponteiro para o número atual de processos
+// O último processo da lista ocupa a posição do removido (remoção em O(1))
+// - lista: lista de processos
 // - pid: identificador do processo a ser removido
-// Retorna: ponteiro para a nova lista com o processo removido
-Processo* remover_processo(Processo *lista, int *n, int pid);
+// Retorna: 1 se removeu, 0 se o PID não foi encontrado
+int remover_processo(ListaProcessos *lista, int pid);
+
+// Retorna o índice do processo com o PID informado, ou -1 se não existir
+int buscar_processo(const ListaProcessos *lista, int pid);
+
+// Substitui todo o conteúdo da lista por um vetor já alocado (a lista assume o vetor)
+// Retorna: 1 se deu certo, 0 se há PIDs repetidos e -1 se faltou memória
+// (nos dois casos a lista fica vazia e o vetor é liberado)
+int substituir_lista(ListaProcessos *lista, Processo *vetor, int n);
+
+// Preenche `ordem` com os índices 0..n-1 ordenados por (tempo_chegada, pid), sem alterar a lista
+// Usa radix sort (LSD), estável e O(n)
+void ordenar_por_chegada(const Processo *lista, int n, int *ordem);
+
+// Retorna os índices da lista em ordem de chegada, compartilhados por todos os algoritmos
+// O vetor é montado uma vez e reaproveitado até a lista ser alterada (NULL se faltar memória)
+const int* ordem_por_chegada(ListaProcessos *lista);
 
 // Declaração da função que reinicializa a lista de processos
-// - lista: ponteiro para o vetor de processos
-// - n: ponteiro para o número de processos (será resetado para 0)
-void reinicializar_lista(Processo **lista, int *n);
+// Libera a memória e deixa a lista vazia, pronta para ser reutilizada
+void reinicializar_lista(ListaProcessos *lista);
 
 #endif                            // Fim da diretiva de inclusão condicional
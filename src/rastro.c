@@ -0,0 +1,370 @@
+/**
+ * @file rastro.c
+ * @brief Gravação, leitura e despejo em texto do rastro binário.
+ *
+ * O escritor segura o último intervalo de cada CPU até saber se o próximo o
+ * continua, e só então o codifica no bloco, que vai para o disco quando
+ * enche. O leitor mantém no bloco pelo menos uma entrada completa, então os
+ * varints nunca ficam partidos entre duas leituras do arquivo.
+ */
+
+#include <stdint.h>     // uint32_t, uint64_t
+#include <stdlib.h>     // malloc, realloc, free, abort
+#include <string.h>     // memcpy, memcmp, memmove
+#include "rastro.h"
+#include "buffer.h"     // Montagem do texto em blocos
+#include "simulador.h"  // nome_algoritmo
+
+#define MAGICO_RASTRO "ESCT"         // Assinatura do rastro
+#define VERSAO_RASTRO 1              // Versão atual do formato
+#define TAMANHO_CABECALHO_RASTRO 8   // Bytes do cabeçalho
+#define BLOCO_RASTRO (1 << 16)       // Tamanho do bloco de escrita e de leitura
+#define MAXIMO_VARINT 10             // Bytes de um varint de 64 bits
+#define MAXIMO_ENTRADA (4 * MAXIMO_VARINT) // Bytes de uma entrada completa, no pior caso
+#define BLOCO_TEXTO (1 << 20)        // Texto acumulado antes de cada gravação no despejo
+
+// Inteiro com sinal -> sem sinal, com valores pequenos (de qualquer sinal) perto de zero
+static uint64_t zigue_zague(long long v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static long long desfazer_zigue_zague(uint64_t v) {
+    return (long long)(v >> 1) ^ -(long long)(v & 1);
+}
+
+// Escreve um varint em b; retorna a quantidade de bytes
+static size_t escrever_varint(unsigned char *b, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        b[n++] = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    b[n++] = (unsigned char)v;
+    return n;
+}
+
+// Lê um varint de [*p, fim); retorna 0 se ele estiver truncado ou for longo demais
+static int ler_varint(const unsigned char **p, const unsigned char *fim, uint64_t *valor) {
+    uint64_t v = 0;
+    for (int deslocamento = 0; deslocamento < 7 * MAXIMO_VARINT; deslocamento += 7) {
+        if (*p >= fim) {
+            return 0;
+        }
+        unsigned char byte = *(*p)++;
+        v |= (uint64_t)(byte & 0x7f) << deslocamento;
+        if ((byte & 0x80) == 0) {
+            *valor = v;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Escrita
+// ---------------------------------------------------------------------------
+
+// Grava o bloco no arquivo e o esvazia
+static void descarregar_bloco(EscritorRastro *e) {
+    if (e->usado > 0 && fwrite(e->bloco, 1, e->usado, e->arquivo) != e->usado) {
+        e->erro = 1;
+    }
+    e->usado = 0;
+}
+
+// Garante espaço para uma entrada completa no bloco
+static void reservar_entrada(EscritorRastro *e) {
+    if (BLOCO_RASTRO - e->usado < MAXIMO_ENTRADA) {
+        descarregar_bloco(e);
+    }
+}
+
+// Codifica o intervalo no bloco
+static void codificar_intervalo(EscritorRastro *e, const RegistroRastro *r) {
+    int troca_cpu = r->cpu != e->cpu_anterior;
+    uint64_t marca = ((zigue_zague((long long)r->pid - e->pid_anterior) << 1) | (uint64_t)troca_cpu) + 1;
+
+    reservar_entrada(e);
+    unsigned char *b = e->bloco + e->usado;
+    size_t n = escrever_varint(b, marca);
+    if (troca_cpu) {
+        n += escrever_varint(b + n, (uint64_t)(uint32_t)r->cpu);
+    }
+    n += escrever_varint(b + n, zigue_zague((long long)r->inicio - e->fim_anterior));
+    n += escrever_varint(b + n, (uint64_t)((long long)r->fim - r->inicio));
+    e->usado += n;
+
+    e->pid_anterior = r->pid;
+    e->cpu_anterior = r->cpu;
+    e->fim_anterior = r->fim;
+}
+
+// Codifica os intervalos pendentes de todas as CPUs
+static void codificar_pendentes(EscritorRastro *e) {
+    for (int c = 0; c < e->n_pendentes; c++) {
+        if (e->pendentes[c].cpu >= 0) {
+            codificar_intervalo(e, &e->pendentes[c]);
+            e->pendentes[c].cpu = -1;
+        }
+    }
+}
+
+// Garante um intervalo pendente (vazio) para cada uma das CPUs 0..n_cpus-1
+static void reservar_pendentes(EscritorRastro *e, int n_cpus) {
+    if (n_cpus <= e->n_pendentes) {
+        return;
+    }
+    RegistroRastro *temp = realloc(e->pendentes, n_cpus * sizeof(RegistroRastro));
+    if (temp == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    for (int c = e->n_pendentes; c < n_cpus; c++) {
+        temp[c].cpu = -1;
+    }
+    e->pendentes = temp;
+    e->n_pendentes = n_cpus;
+}
+
+StatusCarga rastro_abrir_escrita(EscritorRastro *escritor, const char *caminho) {
+    escritor->bloco = malloc(BLOCO_RASTRO);
+    if (escritor->bloco == NULL) {
+        return CARGA_ERRO_MEMORIA;
+    }
+    escritor->arquivo = fopen(caminho, "wb");
+    if (escritor->arquivo == NULL) {
+        free(escritor->bloco);
+        return CARGA_ERRO_ARQUIVO;
+    }
+
+    memcpy(escritor->bloco, MAGICO_RASTRO, 4);
+    escritor->bloco[4] = VERSAO_RASTRO;
+    escritor->bloco[5] = 0;
+    escritor->bloco[6] = 0;
+    escritor->bloco[7] = 0;
+    escritor->usado = TAMANHO_CABECALHO_RASTRO;
+    escritor->pendentes = NULL;
+    escritor->n_pendentes = 0;
+    escritor->pid_anterior = 0;
+    escritor->cpu_anterior = 0;
+    escritor->fim_anterior = 0;
+    escritor->erro = 0;
+    return CARGA_OK;
+}
+
+void rastro_iniciar_execucao(EscritorRastro *escritor, Algoritmo algoritmo, int n_cpus) {
+    codificar_pendentes(escritor);
+    reservar_pendentes(escritor, n_cpus);
+    reservar_entrada(escritor);
+    unsigned char *b = escritor->bloco + escritor->usado;
+    size_t n = escrever_varint(b, 0);
+    n += escrever_varint(b + n, (uint64_t)algoritmo);
+    n += escrever_varint(b + n, (uint64_t)(n_cpus > 0 ? n_cpus : 1));
+    escritor->usado += n;
+
+    // Cada execução começa a diferença do zero: pode ser lida sem as anteriores
+    escritor->pid_anterior = 0;
+    escritor->cpu_anterior = 0;
+    escritor->fim_anterior = 0;
+}
+
+void rastro_registrar(EscritorRastro *escritor, int cpu, int pid, int inicio, int fim) {
+    reservar_pendentes(escritor, cpu + 1);
+    RegistroRastro *p = &escritor->pendentes[cpu];
+    if (p->cpu >= 0) {
+        if (p->pid == pid && p->fim == inicio) {
+            p->fim = fim;       // Continuação direta: apenas estende
+            return;
+        }
+        codificar_intervalo(escritor, p);
+    }
+    p->pid = pid;
+    p->cpu = cpu;
+    p->inicio = inicio;
+    p->fim = fim;
+}
+
+StatusCarga rastro_fechar_escrita(EscritorRastro *escritor) {
+    codificar_pendentes(escritor);
+    descarregar_bloco(escritor);
+    if (fclose(escritor->arquivo) != 0) {
+        escritor->erro = 1;
+    }
+    free(escritor->bloco);
+    free(escritor->pendentes);
+    escritor->arquivo = NULL;
+    escritor->bloco = NULL;
+    escritor->pendentes = NULL;
+    escritor->n_pendentes = 0;
+    return escritor->erro ? CARGA_ERRO_ARQUIVO : CARGA_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Leitura
+// ---------------------------------------------------------------------------
+
+// Completa o bloco quando sobra menos de uma entrada completa para interpretar
+static void completar_bloco(LeitorRastro *l) {
+    if (l->fim_arquivo || l->fim - l->inicio >= MAXIMO_ENTRADA) {
+        return;
+    }
+    memmove(l->bloco, l->bloco + l->inicio, l->fim - l->inicio);
+    l->fim -= l->inicio;
+    l->inicio = 0;
+    while (!l->fim_arquivo && l->fim < MAXIMO_ENTRADA) {
+        size_t lido = fread(l->bloco + l->fim, 1, BLOCO_RASTRO - l->fim, l->arquivo);
+        l->fim += lido;
+        if (lido == 0) {
+            l->fim_arquivo = 1;
+        }
+    }
+}
+
+StatusCarga rastro_abrir_leitura(LeitorRastro *leitor, const char *caminho) {
+    unsigned char cabecalho[TAMANHO_CABECALHO_RASTRO];
+
+    leitor->arquivo = fopen(caminho, "rb");
+    if (leitor->arquivo == NULL) {
+        return CARGA_ERRO_ARQUIVO;
+    }
+    if (fread(cabecalho, 1, TAMANHO_CABECALHO_RASTRO, leitor->arquivo) != TAMANHO_CABECALHO_RASTRO ||
+        memcmp(cabecalho, MAGICO_RASTRO, 4) != 0 ||
+        ((uint32_t)cabecalho[4] | ((uint32_t)cabecalho[5] << 8) |
+         ((uint32_t)cabecalho[6] << 16) | ((uint32_t)cabecalho[7] << 24)) != VERSAO_RASTRO) {
+        fclose(leitor->arquivo);
+        return CARGA_ERRO_FORMATO;
+    }
+    leitor->bloco = malloc(BLOCO_RASTRO);
+    if (leitor->bloco == NULL) {
+        fclose(leitor->arquivo);
+        return CARGA_ERRO_MEMORIA;
+    }
+
+    leitor->inicio = 0;
+    leitor->fim = 0;
+    leitor->fim_arquivo = 0;
+    leitor->pid_anterior = 0;
+    leitor->cpu_anterior = 0;
+    leitor->fim_anterior = 0;
+    return CARGA_OK;
+}
+
+int rastro_ler(LeitorRastro *leitor, EntradaRastro *entrada) {
+    completar_bloco(leitor);
+    if (leitor->inicio == leitor->fim) {
+        return 0;
+    }
+
+    const unsigned char *p = leitor->bloco + leitor->inicio;
+    const unsigned char *fim = leitor->bloco + leitor->fim;
+    uint64_t marca, a, b;
+    if (!ler_varint(&p, fim, &marca)) {
+        return -1;
+    }
+
+    if (marca == 0) {
+        if (!ler_varint(&p, fim, &a) || !ler_varint(&p, fim, &b) ||
+            a >= N_ALGORITMOS || b < 1 || b > 2147483647u) {
+            return -1;
+        }
+        entrada->tipo = RASTRO_EXECUCAO;
+        entrada->algoritmo = (Algoritmo)a;
+        entrada->n_cpus = (int)b;
+        leitor->pid_anterior = 0;
+        leitor->cpu_anterior = 0;
+        leitor->fim_anterior = 0;
+    } else {
+        uint64_t v = marca - 1;
+        int cpu = leitor->cpu_anterior;
+        if (v & 1) {
+            uint64_t nova;
+            if (!ler_varint(&p, fim, &nova) || nova > 2147483647u) {
+                return -1;
+            }
+            cpu = (int)nova;
+        }
+        if (!ler_varint(&p, fim, &a) || !ler_varint(&p, fim, &b)) {
+            return -1;
+        }
+        long long pid = leitor->pid_anterior + desfazer_zigue_zague(v >> 1);
+        long long inicio = leitor->fim_anterior + desfazer_zigue_zague(a);
+        long long termino = inicio + (long long)b;
+        if (pid < -2147483647LL - 1 || pid > 2147483647LL || inicio < -2147483647LL - 1 ||
+            b > 2147483647u || termino > 2147483647LL) {
+            return -1;
+        }
+        entrada->tipo = RASTRO_INTERVALO;
+        entrada->intervalo.pid = (int)pid;
+        entrada->intervalo.cpu = cpu;
+        entrada->intervalo.inicio = (int)inicio;
+        entrada->intervalo.fim = (int)termino;
+        leitor->pid_anterior = (int)pid;
+        leitor->cpu_anterior = cpu;
+        leitor->fim_anterior = (int)termino;
+    }
+
+    leitor->inicio = (size_t)(p - leitor->bloco);
+    return 1;
+}
+
+void rastro_fechar_leitura(LeitorRastro *leitor) {
+    fclose(leitor->arquivo);
+    free(leitor->bloco);
+    leitor->arquivo = NULL;
+    leitor->bloco = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Despejo em texto
+// ---------------------------------------------------------------------------
+
+StatusCarga rastro_despejar_texto(const char *caminho, FILE *saida) {
+    LeitorRastro leitor;
+    StatusCarga status = rastro_abrir_leitura(&leitor, caminho);
+    if (status != CARGA_OK) {
+        return status;
+    }
+
+    BufferSaida texto;
+    EntradaRastro e;
+    int n_cpus = 1;
+    int execucoes = 0;
+    int lida;
+    int ok = 1;
+    buffer_inicializar(&texto);
+
+    while (ok && (lida = rastro_ler(&leitor, &e)) > 0) {
+        if (e.tipo == RASTRO_EXECUCAO) {
+            n_cpus = e.n_cpus;
+            if (execucoes++ > 0) {
+                buffer_anexar(&texto, "\n");
+            }
+            buffer_anexar_formatado(&texto, "Rastro %s", nome_algoritmo(e.algoritmo));
+            if (n_cpus > 1) {
+                buffer_anexar_formatado(&texto, " em %d CPUs", n_cpus);
+            }
+            buffer_anexar(&texto, ":\n");
+        } else if (n_cpus > 1) {
+            buffer_anexar_formatado(&texto, "Tempo %d-%d: PID %d na CPU %d\n",
+                                    e.intervalo.inicio, e.intervalo.fim, e.intervalo.pid, e.intervalo.cpu);
+        } else {
+            buffer_anexar_formatado(&texto, "Tempo %d-%d: PID %d\n",
+                                    e.intervalo.inicio, e.intervalo.fim, e.intervalo.pid);
+        }
+
+        // Grava o texto em blocos de ~1 MB
+        if (texto.tamanho >= BLOCO_TEXTO) {
+            ok = fwrite(texto.dados, 1, texto.tamanho, saida) == texto.tamanho;
+            buffer_limpar(&texto);
+        }
+    }
+    if (ok && texto.tamanho > 0) {
+        ok = fwrite(texto.dados, 1, texto.tamanho, saida) == texto.tamanho;
+    }
+
+    buffer_liberar(&texto);
+    rastro_fechar_leitura(&leitor);
+    if (!ok) {
+        return CARGA_ERRO_ARQUIVO;
+    }
+    return lida < 0 ? CARGA_ERRO_FORMATO : CARGA_OK;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file rastro.h
+ * @brief Rastro binário compacto da execução, gravado durante a simulação.
+ *
+ * O rastro guarda os intervalos (pid, início, fim) de cada execução em
+ * inteiros de tamanho variável (varint, 7 bits por byte) codificados em
+ * diferença do intervalo anterior: a troca de PID em zigue-zague, o início em
+ * relação ao fim anterior (0 quando a CPU não fica ociosa) e a duração.
+ * Um intervalo típico ocupa 3 bytes, contra ~40 da linha de texto equivalente.
+ *
+ * Formato: cabeçalho de 8 bytes ("ESCT", versão em 32 bits little-endian)
+ * seguido de entradas que começam por um varint `marca`:
+ *  - marca 0: início de uma execução, seguido de algoritmo e quantidade de CPUs;
+ *  - marca m > 0: intervalo; v = m - 1, o bit 0 de v indica que a CPU mudou
+ *    (e um varint com a nova CPU vem a seguir) e v >> 1 é a diferença de PID
+ *    em zigue-zague; depois vêm o início e a duração.
+ *
+ * O escritor segura o último intervalo de cada CPU até saber se o próximo o
+ * continua: com várias CPUs, os intervalos saem na ordem em que terminam.
+ * Escrita e leitura usam um bloco de tamanho fixo: nem o rastro inteiro nem
+ * a lista de intervalos precisam caber na memória para gravar ou despejar.
+ */
+
+#ifndef RASTRO_H              // Evita inclusão duplicada
+#define RASTRO_H
+
+#include <stdio.h>            // FILE
+#include "resultado.h"        // Algoritmo
+#include "carga.h"            // StatusCarga
+
+// Um intervalo do rastro
+typedef struct {
+    int pid;
+    int cpu;
+    int inicio;
+    int fim;                  // Exclusivo
+} RegistroRastro;
+
+// Gravação em andamento
+typedef struct EscritorRastro {
+    FILE *arquivo;
+    unsigned char *bloco;     // Bytes ainda não gravados no arquivo
+    size_t usado;             // Bytes ocupados em `bloco`
+    RegistroRastro *pendentes; // Último intervalo de cada CPU, ainda não codificado (cpu -1 = nenhum)
+    int n_pendentes;          // CPUs em `pendentes`
+    int pid_anterior;         // Estado da codificação em diferença
+    int cpu_anterior;
+    int fim_anterior;
+    int erro;                 // 1 se alguma gravação falhou
+} EscritorRastro;
+
+// Tipos de entrada lidas do rastro
+typedef enum {
+    RASTRO_EXECUCAO,          // Início de uma execução (campos algoritmo e n_cpus)
+    RASTRO_INTERVALO          // Um intervalo (campo intervalo)
+} TipoEntradaRastro;
+
+// Entrada lida do rastro
+typedef struct {
+    TipoEntradaRastro tipo;
+    Algoritmo algoritmo;
+    int n_cpus;
+    RegistroRastro intervalo;
+} EntradaRastro;
+
+// Leitura em andamento
+typedef struct {
+    FILE *arquivo;
+    unsigned char *bloco;     // Bytes lidos do arquivo e ainda não interpretados
+    size_t inicio;            // Próximo byte a interpretar
+    size_t fim;               // Fim dos bytes válidos em `bloco`
+    int fim_arquivo;          // 1 quando não há mais nada a ler do arquivo
+    int pid_anterior;
+    int cpu_anterior;
+    int fim_anterior;
+} LeitorRastro;
+
+// Cria o arquivo e grava o cabeçalho
+StatusCarga rastro_abrir_escrita(EscritorRastro *escritor, const char *caminho);
+
+// Marca o início de uma execução; os intervalos seguintes pertencem a ela
+void rastro_iniciar_execucao(EscritorRastro *escritor, Algoritmo algoritmo, int n_cpus);
+
+// Acrescenta um intervalo; a continuação direta do anterior na mesma CPU
+// (mesmo PID, início igual ao fim anterior) apenas o estende
+void rastro_registrar(EscritorRastro *escritor, int cpu, int pid, int inicio, int fim);
+
+// Grava o que falta, fecha o arquivo e libera o escritor
+StatusCarga rastro_fechar_escrita(EscritorRastro *escritor);
+
+// Abre o rastro e confere o cabeçalho
+StatusCarga rastro_abrir_leitura(LeitorRastro *leitor, const char *caminho);
+
+// Lê a próxima entrada
+// Retorna 1 se leu, 0 no fim do rastro e -1 se o conteúdo for inválido ou estiver truncado
+int rastro_ler(LeitorRastro *leitor, EntradaRastro *entrada);
+
+// Fecha o arquivo e libera o leitor
+void rastro_fechar_leitura(LeitorRastro *leitor);
+
+// Escreve o rastro em texto, um intervalo por linha, lendo-o aos poucos
+StatusCarga rastro_despejar_texto(const char *caminho, FILE *saida);
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file relatorio.c
+ * @brief Geração do relatório em texto de uma simulação.
+ *
+ * Toda a formatação de texto fica aqui, fora do laço dos algoritmos:
+ * quem só precisa dos números usa o ResultadoSimulacao diretamente.
+ */
+
+#include <stdlib.h>     // calloc, free
+#include "relatorio.h"
+#include "simulador.h"  // nome_algoritmo
+
+// Anexa uma linha da tabela de métricas
+static void anexar_linha_metricas(BufferSaida *saida, const MetricaProcesso *m) {
+    buffer_anexar_formatado(saida, "%-6d\t%-7d\t%-7d\t%-11d\t%-6d\n",
+                            m->pid, m->inicio, m->fim, m->turnaround, m->espera);
+}
+
+// Anexa a tabela de métricas na ordem em que os processos terminaram
+static void anexar_tabela(const ResultadoSimulacao *res, BufferSaida *saida) {
+    buffer_anexar(saida, "PID\tInício\tFim\tTurnaround\tEspera\n");
+    for (int k = 0; k < res->n_concluidos; k++) {
+        anexar_linha_metricas(saida, &res->metricas[res->ordem_conclusao[k]]);
+    }
+}
+
+// Anexa o log de execução, um intervalo por linha, com o tempo restante de cada processo
+static void anexar_log_execucao(const ResultadoSimulacao *res, BufferSaida *saida) {
+    int *executado = calloc(res->n > 0 ? res->n : 1, sizeof(int)); // Tempo já executado por processo
+
+    buffer_anexar(saida, "Execução passo a passo:\n");
+    for (int k = 0; k < res->n_intervalos; k++) {
+        const Intervalo *it = &res->intervalos[k];
+        const MetricaProcesso *m = &res->metricas[it->indice];
+
+        executado[it->indice] += it->fim - it->inicio;
+        if (res->n_cpus > 1) {
+            buffer_anexar_formatado(saida, "Tempo %d-%d: PID %d na CPU %d (restante: %d)\n",
+                                    it->inicio, it->fim, m->pid, it->cpu,
+                                    m->tempo_execucao - executado[it->indice]);
+        } else {
+            buffer_anexar_formatado(saida, "Tempo %d-%d: PID %d (restante: %d)\n",
+                                    it->inicio, it->fim, m->pid,
+                                    m->tempo_execucao - executado[it->indice]);
+        }
+    }
+    free(executado);
+}
+
+// Anexa o título da simulação (com a quantidade de CPUs, se houver mais de uma)
+static void anexar_titulo(const ResultadoSimulacao *res, BufferSaida *saida) {
+    switch (res->algoritmo) {
+        case ALGORITMO_FIFO:
+            buffer_anexar(saida, "Simulação FIFO");
+            break;
+        case ALGORITMO_SJF:
+            buffer_anexar(saida, "Simulação SJF");
+            break;
+        case ALGORITMO_ROUND_ROBIN:
+            buffer_anexar_formatado(saida, "Simulação Round-Robin (Q=%d)", res->quantum);
+            break;
+        case ALGORITMO_PRIORIDADE:
+            buffer_anexar(saida, "Simulação Prioridade Preemptiva");
+            break;
+        case ALGORITMO_MLFQ:
+            buffer_anexar_formatado(saida, "Simulação MLFQ (Q0=%d)", res->quantum);
+            break;
+        case ALGORITMO_CFS:
+            buffer_anexar_formatado(saida, "Simulação CFS (latência=%d)", res->quantum);
+            break;
+        case ALGORITMO_SRTF:
+            buffer_anexar(saida, "Simulação SRTF (SJF Preemptivo)");
+            break;
+        default:
+            break;
+    }
+    if (res->n_cpus > 1) {
+        buffer_anexar_formatado(saida, " em %d CPUs", res->n_cpus);
+    }
+    buffer_anexar(saida, ":\n");
+}
+
+// Anexa o tempo ocupado de cada CPU e o desequilíbrio de carga entre elas
+static void anexar_uso_cpus(const ResultadoSimulacao *res, BufferSaida *saida) {
+    int duracao = res->instante_final;  // Fim do último processo concluído
+    long long total = 0, maior = 0;
+
+    buffer_anexar(saida, "\nUso das CPUs:\nCPU\tOcupado\tUtilização\n");
+    for (int c = 0; c < res->n_cpus; c++) {
+        long long ocupado = res->ocupado_cpu[c];
+        total += ocupado;
+        if (ocupado > maior) {
+            maior = ocupado;
+        }
+        buffer_anexar_formatado(saida, "%-6d\t%-7lld\t%.1f%%\n", c, ocupado,
+                                duracao > 0 ? 100.0 * ocupado / duracao : 0.0);
+    }
+
+    // Desequilíbrio: quanto a CPU mais ocupada passa da média (0% = carga perfeitamente dividida)
+    double media = (double)total / res->n_cpus;
+    buffer_anexar_formatado(saida, "Utilização média: %.1f%%\n",
+                            duracao > 0 ? 100.0 * media / duracao : 0.0);
+    buffer_anexar_formatado(saida, "Desequilíbrio de carga: %.1f%%\n",
+                            media > 0 ? 100.0 * (maior / media - 1.0) : 0.0);
+    buffer_anexar_formatado(saida, "Migrações: %lld\tRoubos: %lld\n", res->n_migracoes, res->n_roubos);
+}
+
+// Anexa uma linha da tabela de estatísticas: média, percentis e máximo do histograma
+static void anexar_linha_estatistica(BufferSaida *saida, const char *nome, const Histograma *h) {
+    buffer_anexar_formatado(saida, "%-11s\t%-9.2f\t%-7d\t%-7d\t%-7d\t%d\n", nome,
+                            histograma_media(h), histograma_percentil(h, 50),
+                            histograma_percentil(h, 90), histograma_percentil(h, 99), h->maximo);
+}
+
+// Anexa as estatísticas agregadas da execução, calculadas durante a simulação
+static void anexar_estatisticas(const ResultadoSimulacao *res, BufferSaida *saida) {
+    long long ocupado = 0;
+    for (int c = 0; c < res->n_cpus; c++) {
+        ocupado += res->ocupado_cpu[c];
+    }
+    int duracao = res->instante_final;
+
+    buffer_anexar_formatado(saida, "\nEstatísticas (%d processos):\n", res->n_concluidos);
+    buffer_anexar(saida, "Métrica\tMédia\tp50\tp90\tp99\tMáx\n");
+    anexar_linha_estatistica(saida, "Turnaround", &res->hist_turnaround);
+    anexar_linha_estatistica(saida, "Espera", &res->hist_espera);
+    anexar_linha_estatistica(saida, "Resposta", &res->hist_resposta);
+    buffer_anexar_formatado(saida, "Vazão: %.4f processos por unidade de tempo\n",
+                            duracao > 0 ? (double)res->n_concluidos / duracao : 0.0);
+    buffer_anexar_formatado(saida, "Utilização da CPU: %.1f%%\n",
+                            duracao > 0 ? 100.0 * ocupado / ((double)duracao * res->n_cpus) : 0.0);
+    buffer_anexar_formatado(saida, "Trocas de contexto: %lld\n", res->n_trocas_contexto);
+}
+
+void formatar_resumo_texto(const ResultadoSimulacao *res, BufferSaida *saida) {
+    anexar_titulo(res, saida);
+    anexar_estatisticas(res, saida);
+    if (res->n_cpus > 1) {
+        anexar_uso_cpus(res, saida);
+    }
+}
+
+void formatar_resultado_texto(const ResultadoSimulacao *res, BufferSaida *saida) {
+    anexar_titulo(res, saida);
+    switch (res->algoritmo) {
+        case ALGORITMO_FIFO:
+        case ALGORITMO_SJF:
+            anexar_tabela(res, saida);
+            break;
+        case ALGORITMO_ROUND_ROBIN:
+        case ALGORITMO_PRIORIDADE:
+        case ALGORITMO_MLFQ:
+        case ALGORITMO_CFS:
+        case ALGORITMO_SRTF:
+            anexar_log_execucao(res, saida);
+            buffer_anexar(saida, "\nResumo Final:\n");
+            anexar_tabela(res, saida);
+            break;
+        default:
+            break;
+    }
+    anexar_estatisticas(res, saida);
+    if (res->n_cpus > 1) {
+        anexar_uso_cpus(res, saida);
+    }
+}
+
+void formatar_instrumentacao_json(const ResultadoSimulacao *res, BufferSaida *saida) {
+    const Instrumentacao *in = &res->instr;
+    buffer_anexar_formatado(saida,
+                            "{\"algoritmo\":\"%s\",\"processos\":%d,\"cpus\":%d,\"instrumentacao\":%s,"
+                            "\"decisoes\":%lld,\"preempcoes\":%lld,\"saltos_ociosos\":%lld,\"max_prontos\":%d,"
+                            "\"tempo_ns\":{\"preparacao\":%lld,\"simulacao\":%lld,\"formatacao\":%lld}}\n",
+                            nome_algoritmo(res->algoritmo), res->n, res->n_cpus, in->ativa ? "true" : "false",
+                            in->decisoes, in->preempcoes, in->saltos_ociosos, in->max_prontos,
+                            in->tempo_fase_ns[FASE_PREPARACAO], in->tempo_fase_ns[FASE_SIMULACAO],
+                            in->tempo_fase_ns[FASE_FORMATACAO]);
+}
+
+void formatar_cabecalho_csv(BufferSaida *saida) {
+    buffer_anexar(saida, "algoritmo,pid,chegada,execucao,inicio,fim,turnaround,espera\n");
+}
+
+void formatar_metrica_csv(Algoritmo algoritmo, const MetricaProcesso *m, BufferSaida *saida) {
+    buffer_anexar_formatado(saida, "%s,%d,%d,%d,%d,%d,%d,%d\n",
+                            nome_algoritmo(algoritmo), m->pid, m->tempo_chegada, m->tempo_execucao,
+                            m->inicio, m->fim, m->turnaround, m->espera);
+}
+
+void formatar_resultado_csv(const ResultadoSimulacao *res, BufferSaida *saida) {
+    for (int k = 0; k < res->n_concluidos; k++) {
+        formatar_metrica_csv(res->algoritmo, &res->metricas[res->ordem_conclusao[k]], saida);
+    }
+}
+
+void formatar_cabecalho_varredura_csv(BufferSaida *saida) {
+    buffer_anexar(saida, "algoritmo,quantum,cpus,amostras,"
+                         "turnaround,turnaround_ic95,espera,espera_ic95,resposta,resposta_ic95,"
+                         "p99_turnaround,p99_turnaround_ic95,vazao,vazao_ic95,"
+                         "utilizacao,utilizacao_ic95,trocas_contexto,trocas_contexto_ic95\n");
+}
+
+// Anexa ",media,ic95" de uma estimativa
+static void anexar_estimativa_csv(BufferSaida *saida, const Estimativa *e) {
+    buffer_anexar_formatado(saida, ",%.6g,%.6g", e->media, e->ic95);
+}
+
+void formatar_varredura_csv(const ConfiguracaoVarredura *cfg, const ResumoVarredura *resumo, BufferSaida *saida) {
+    int n_cpus = cfg->cpus.n_cpus > 1 && multicpu_suporta(cfg->algoritmo) ? cfg->cpus.n_cpus : 1;
+    buffer_anexar_formatado(saida, "%s,%d,%d,%d", nome_algoritmo(cfg->algoritmo),
+                            cfg->parametros.quantum, n_cpus, resumo->amostras);
+    anexar_estimativa_csv(saida, &resumo->turnaround);
+    anexar_estimativa_csv(saida, &resumo->espera);
+    anexar_estimativa_csv(saida, &resumo->resposta);
+    anexar_estimativa_csv(saida, &resumo->p99_turnaround);
+    anexar_estimativa_csv(saida, &resumo->vazao);
+    anexar_estimativa_csv(saida, &resumo->utilizacao);
+    anexar_estimativa_csv(saida, &resumo->trocas_contexto);
+    buffer_anexar(saida, "\n");
+}
@@ -0,0 +1,49 @@
+/**
+ * @file relatorio.h
+ * @brief Formatação dos resultados de simulação.
+ *
+ * Converte um ResultadoSimulacao em texto legível para exibição na interface
+ * ou em CSV para processamento por outras ferramentas.
+ */
+
+#ifndef RELATORIO_H           // Evita inclusão duplicada
+#define RELATORIO_H
+
+#include "buffer.h"           // Buffer de texto crescente
+#include "resultado.h"        // Resultado estruturado da simulação
+#include "varredura.h"        // Resumos da varredura de parâmetros
+
+// Anexa ao buffer o relatório em texto do resultado: log de execução
+// (algoritmos preemptivos), a tabela PID/Início/Fim/Turnaround/Espera e as
+// estatísticas agregadas; com mais de uma CPU, também o uso de cada CPU e o
+// desequilíbrio de carga
+void formatar_resultado_texto(const ResultadoSimulacao *res, BufferSaida *saida);
+
+// Anexa apenas o título e as estatísticas agregadas (média, p50, p90, p99 e
+// máximo de turnaround, espera e resposta; vazão, utilização e trocas de
+// contexto), sem nenhuma linha por processo
+void formatar_resumo_texto(const ResultadoSimulacao *res, BufferSaida *saida);
+
+// Anexa um objeto JSON em uma linha com os contadores e tempos de cada fase
+// coletados pela instrumentação (ver instrumentacao.h); sem ela, "instrumentacao"
+// é false e os valores são zero
+void formatar_instrumentacao_json(const ResultadoSimulacao *res, BufferSaida *saida);
+
+// Anexa a linha de cabeçalho das colunas do CSV
+void formatar_cabecalho_csv(BufferSaida *saida);
+
+// Anexa a linha CSV de um processo (as mesmas colunas de formatar_resultado_csv)
+void formatar_metrica_csv(Algoritmo algoritmo, const MetricaProcesso *metrica, BufferSaida *saida);
+
+// Anexa uma linha CSV por processo, na ordem de conclusão
+// Colunas: algoritmo,pid,chegada,execucao,inicio,fim,turnaround,espera
+void formatar_resultado_csv(const ResultadoSimulacao *res, BufferSaida *saida);
+
+// Anexa a linha de cabeçalho do CSV da varredura
+void formatar_cabecalho_varredura_csv(BufferSaida *saida);
+
+// Anexa uma linha CSV com o resumo de uma combinação da varredura
+// Colunas: algoritmo,quantum,cpus,amostras e, para cada métrica, a média e o ic95
+void formatar_varredura_csv(const ConfiguracaoVarredura *cfg, const ResumoVarredura *resumo, BufferSaida *saida);
+
+#endif
@@ -0,0 +1,277 @@
+/**
+ * @file resultado.c
+ * @brief Preenchimento do resultado estruturado das simulações.
+ *
+ * Funções chamadas pelos algoritmos durante a simulação para registrar os
+ * intervalos de execução e o término de cada processo, sem formatar texto.
+ */
+
+#include <stdlib.h>     // realloc, free
+#include <string.h>     // memset
+#include "resultado.h"
+#include "rastro.h"      // rastro_registrar
+
+// Zera os contadores e tempos da instrumentação
+static void zerar_instrumentacao(Instrumentacao *in) {
+    memset(in, 0, sizeof(*in));
+    in->ativa = INSTR_ATIVA;
+    in->devolvido = -1;
+}
+
+void resultado_inicializar(ResultadoSimulacao *res) {
+    res->algoritmo = ALGORITMO_FIFO;
+    res->fluxo = 0;
+    res->quantum = 0;
+    res->n = 0;
+    res->metricas = NULL;
+    res->ordem_conclusao = NULL;
+    res->n_concluidos = 0;
+    res->intervalos = NULL;
+    res->n_intervalos = 0;
+    res->capacidade_processos = 0;
+    res->capacidade_intervalos = 0;
+    res->n_cpus = 0;
+    res->ocupado_cpu = NULL;
+    res->ultimo_intervalo_cpu = NULL;
+    res->capacidade_cpus = 0;
+    res->n_migracoes = 0;
+    res->n_roubos = 0;
+    res->n_trocas_contexto = 0;
+    res->instante_final = 0;
+    histograma_inicializar(&res->hist_turnaround);
+    histograma_inicializar(&res->hist_espera);
+    histograma_inicializar(&res->hist_resposta);
+    zerar_instrumentacao(&res->instr);
+    res->controle = NULL;
+    res->rastro = NULL;
+    res->cancelada = 0;
+    res->estouro_relogio = 0;
+    res->passos = 0;
+}
+
+// Métrica de um processo que ainda não executou
+static inline void preencher_metrica(MetricaProcesso *m, const Processo *processo) {
+    m->pid = processo->pid;
+    m->tempo_chegada = processo->tempo_chegada;
+    m->tempo_execucao = processo->tempo_execucao;
+    m->inicio = -1;
+    m->fim = -1;
+    m->turnaround = 0;
+    m->espera = 0;
+}
+
+// Zera os contadores de uma nova simulação, sem tocar nas métricas
+static void reiniciar_contadores(ResultadoSimulacao *res, Algoritmo algoritmo) {
+    res->algoritmo = algoritmo;
+    res->fluxo = 0;
+    res->quantum = 0;
+    res->n_concluidos = 0;
+    res->n_intervalos = 0;
+    res->cancelada = 0;
+    res->estouro_relogio = 0;
+    res->passos = 0;
+    res->n_migracoes = 0;
+    res->n_roubos = 0;
+    res->n_trocas_contexto = 0;
+    res->instante_final = 0;
+    histograma_limpar(&res->hist_turnaround);
+    histograma_limpar(&res->hist_espera);
+    histograma_limpar(&res->hist_resposta);
+    resultado_definir_cpus(res, 1);
+}
+
+void resultado_preparar(ResultadoSimulacao *res, Algoritmo algoritmo, const Processo *lista_processos, int n) {
+    zerar_instrumentacao(&res->instr);
+    INSTR_INICIAR_FASE(res, FASE_PREPARACAO);
+
+    // Só realoca quando a nova lista não cabe na memória já reservada
+    resultado_reservar_vagas(res, n);
+
+    res->n = n;
+    reiniciar_contadores(res, algoritmo);
+
+    for (int i = 0; i < n; i++) {
+        preencher_metrica(&res->metricas[i], &lista_processos[i]);
+    }
+    INSTR_ENCERRAR_FASE(res, FASE_PREPARACAO);
+}
+
+void resultado_preparar_continuacao(ResultadoSimulacao *res, Algoritmo algoritmo,
+                                    const Processo *lista_processos, int n, int mantidos) {
+    zerar_instrumentacao(&res->instr);
+    INSTR_INICIAR_FASE(res, FASE_PREPARACAO);
+
+    resultado_reservar_vagas(res, n);       // realloc mantém as métricas e a ordem de conclusão
+    res->n = n;
+    reiniciar_contadores(res, algoritmo);
+
+    for (int i = mantidos; i < n; i++) {
+        preencher_metrica(&res->metricas[i], &lista_processos[i]);
+    }
+    INSTR_ENCERRAR_FASE(res, FASE_PREPARACAO);
+}
+
+// Garante espaço para pelo menos `minimo` intervalos
+static void reservar_intervalos(ResultadoSimulacao *res, int minimo) {
+    if (minimo <= res->capacidade_intervalos) {
+        return;
+    }
+    int nova = res->capacidade_intervalos ? res->capacidade_intervalos * 2 : 64;
+    while (nova < minimo) {
+        nova *= 2;
+    }
+    Intervalo *temp = realloc(res->intervalos, nova * sizeof(Intervalo));
+    if (temp == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    res->intervalos = temp;
+    res->capacidade_intervalos = nova;
+}
+
+void resultado_preparar_fluxo(ResultadoSimulacao *res, Algoritmo algoritmo) {
+    resultado_preparar(res, algoritmo, NULL, 0);
+    res->fluxo = 1;
+    reservar_intervalos(res, res->n_cpus);
+}
+
+void resultado_reservar_vagas(ResultadoSimulacao *res, int capacidade) {
+    if (capacidade <= res->capacidade_processos) {
+        return;
+    }
+    // A ordem de conclusão acompanha a capacidade, para uma simulação completa
+    // seguinte poder reaproveitar os dois vetores
+    MetricaProcesso *metricas = realloc(res->metricas, capacidade * sizeof(MetricaProcesso));
+    int *ordem = realloc(res->ordem_conclusao, capacidade * sizeof(int));
+    if (metricas == NULL || ordem == NULL) {
+        abort();                // Sem memória não há como continuar a simulação
+    }
+    res->metricas = metricas;
+    res->ordem_conclusao = ordem;
+    res->capacidade_processos = capacidade;
+}
+
+void resultado_admitir(ResultadoSimulacao *res, int indice, const Processo *processo) {
+    preencher_metrica(&res->metricas[indice], processo);
+    res->n++;
+}
+
+void resultado_definir_cpus(ResultadoSimulacao *res, int n_cpus) {
+    if (n_cpus < 1) {
+        n_cpus = 1;
+    }
+    if (n_cpus > res->capacidade_cpus) {
+        long long *ocupado = realloc(res->ocupado_cpu, n_cpus * sizeof(long long));
+        int *ultimo = realloc(res->ultimo_intervalo_cpu, n_cpus * sizeof(int));
+        if (ocupado == NULL || ultimo == NULL) {
+            abort();            // Sem memória não há como continuar a simulação
+        }
+        res->ocupado_cpu = ocupado;
+        res->ultimo_intervalo_cpu = ultimo;
+        res->capacidade_cpus = n_cpus;
+    }
+
+    res->n_cpus = n_cpus;
+    for (int c = 0; c < n_cpus; c++) {
+        res->ocupado_cpu[c] = 0;
+        res->ultimo_intervalo_cpu[c] = -1;
+    }
+}
+
+void resultado_registrar_intervalo(ResultadoSimulacao *res, int indice, int inicio, int fim) {
+    resultado_registrar_intervalo_cpu(res, 0, indice, inicio, fim);
+}
+
+void resultado_registrar_intervalo_cpu(ResultadoSimulacao *res, int cpu, int indice, int inicio, int fim) {
+    if (res->metricas[indice].inicio == -1) {
+        res->metricas[indice].inicio = inicio;   // Primeira execução do processo
+    }
+    res->ocupado_cpu[cpu] += fim - inicio;
+    if (res->rastro != NULL) {
+        rastro_registrar(res->rastro, cpu, res->metricas[indice].pid, inicio, fim);
+    }
+
+    // Continuação direta do último intervalo desta CPU: apenas estende o fim
+    int ultimo = res->ultimo_intervalo_cpu[cpu];
+    if (ultimo >= 0) {
+        Intervalo *it = &res->intervalos[ultimo];
+        if (it->indice == indice && it->fim == inicio) {
+            it->fim = fim;
+            return;
+        }
+        if (it->indice != indice) {
+            res->n_trocas_contexto++;       // A CPU troca de processo
+        }
+    }
+
+    // Em fluxo, o novo intervalo só substitui o último da CPU, na posição dela
+    int posicao = cpu;
+    if (!res->fluxo) {
+        if (res->n_intervalos == res->capacidade_intervalos) {
+            reservar_intervalos(res, res->n_intervalos + 1);
+        }
+        posicao = res->n_intervalos++;
+    }
+
+    res->ultimo_intervalo_cpu[cpu] = posicao;
+    Intervalo *novo = &res->intervalos[posicao];
+    novo->indice = indice;
+    novo->cpu = cpu;
+    novo->inicio = inicio;
+    novo->fim = fim;
+}
+
+void resultado_registrar_conclusao(ResultadoSimulacao *res, int indice, int fim) {
+    MetricaProcesso *m = &res->metricas[indice];
+    m->fim = fim;
+    m->turnaround = fim - m->tempo_chegada;          // Tempo total no sistema
+    m->espera = m->turnaround - m->tempo_execucao;   // Tempo na fila de prontos
+    if (res->fluxo) {
+        // A vaga será reaproveitada: o próximo processo dela não é continuação deste
+        for (int c = 0; c < res->n_cpus; c++) {
+            int ultimo = res->ultimo_intervalo_cpu[c];
+            if (ultimo >= 0 && res->intervalos[ultimo].indice == indice) {
+                res->intervalos[ultimo].indice = -1;
+            }
+        }
+    } else {
+        res->ordem_conclusao[res->n_concluidos] = indice;
+    }
+    res->n_concluidos++;
+
+    // Estatísticas agregadas atualizadas aqui, sem precisar de outra passada no fim
+    if (fim > res->instante_final) {
+        res->instante_final = fim;
+    }
+    histograma_registrar(&res->hist_turnaround, m->turnaround);
+    histograma_registrar(&res->hist_espera, m->espera);
+    histograma_registrar(&res->hist_resposta, m->inicio - m->tempo_chegada);
+}
+
+int resultado_publicar_progresso(ResultadoSimulacao *res, int tempo_atual) {
+    ControleSimulacao *c = res->controle;
+    if (c == NULL) {
+        return 0;
+    }
+
+    // A ordem relaxada basta: os valores são apenas informativos para quem observa
+    atomic_store_explicit(&c->concluidos, res->n_concluidos, memory_order_relaxed);
+    atomic_store_explicit(&c->tempo_atual, tempo_atual, memory_order_relaxed);
+
+    if (atomic_load_explicit(&c->cancelar, memory_order_relaxed)) {
+        res->cancelada = 1;
+        return 1;
+    }
+    return 0;
+}
+
+void resultado_liberar(ResultadoSimulacao *res) {
+    free(res->metricas);
+    free(res->ordem_conclusao);
+    free(res->intervalos);
+    free(res->ocupado_cpu);
+    free(res->ultimo_intervalo_cpu);
+    histograma_liberar(&res->hist_turnaround);
+    histograma_liberar(&res->hist_espera);
+    histograma_liberar(&res->hist_resposta);
+    resultado_inicializar(res);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file resultado.h
+ * @brief Resultado estruturado de uma simulação de escalonamento.
+ *
+ * Os algoritmos preenchem diretamente as métricas de cada processo e a lista
+ * de intervalos de execução. A formatação em texto (ou qualquer outro formato)
+ * é feita depois, por quem consome o resultado.
+ *
+ * Na simulação em fluxo (ver simular_em_fluxo) o resultado não guarda nada
+ * proporcional ao total de processos: `metricas` tem uma posição por vaga de
+ * processo residente, e a ordem de conclusão e os intervalos não são
+ * guardados (só o último de cada CPU, para unir continuações). As
+ * estatísticas agregadas e os histogramas são os mesmos da simulação completa.
+ */
+
+#ifndef RESULTADO_H           // Evita inclusão duplicada
+#define RESULTADO_H
+
+#include <stdatomic.h>        // Campos de controle lidos/escritos por outra thread
+#include "processos.h"        // Definição da struct Processo
+#include "histograma.h"       // Percentis de turnaround, espera e resposta
+#include "instrumentacao.h"   // Contadores e cronômetros internos (opcionais)
+
+// Algoritmos disponíveis (mesma ordem da tela de seleção)
+typedef enum {
+    ALGORITMO_FIFO,
+    ALGORITMO_SJF,
+    ALGORITMO_ROUND_ROBIN,
+    ALGORITMO_PRIORIDADE,
+    ALGORITMO_MLFQ,
+    ALGORITMO_CFS,
+    ALGORITMO_SRTF,
+    N_ALGORITMOS              // Quantidade de algoritmos (não é um algoritmo)
+} Algoritmo;
+
+// Métricas finais de um processo
+typedef struct {
+    int pid;                  // Identificador do processo
+    int tempo_chegada;        // Momento em que o processo chegou
+    int tempo_execucao;       // Duração total da execução
+    int inicio;               // Primeira vez que o processo executou (-1 = ainda não executou)
+    int fim;                  // Momento em que o processo terminou
+    int turnaround;           // fim - chegada
+    int espera;               // turnaround - execução
+} MetricaProcesso;
+
+// Intervalo contínuo em que uma CPU executou um único processo
+typedef struct {
+    int indice;               // Índice do processo em `metricas`
+    int cpu;                  // CPU que executou o intervalo (0 na simulação com uma CPU)
+    int inicio;               // Início do intervalo
+    int fim;                  // Fim do intervalo (exclusivo)
+} Intervalo;
+
+// Controle de uma simulação em andamento, compartilhado com outra thread
+// (por exemplo, a interface gráfica que mostra o progresso e pode cancelar)
+typedef struct {
+    atomic_int cancelar;          // Escrito por quem controla: diferente de 0 pede o fim da simulação
+    atomic_int concluidos;        // Publicado pela simulação: processos concluídos até agora
+    atomic_int tempo_atual;       // Publicado pela simulação: tempo simulado atual
+} ControleSimulacao;
+
+// Quantidade de passos da simulação entre duas publicações de progresso (potência de 2)
+#define PASSOS_POR_VERIFICACAO 4096
+
+struct EscritorRastro;         // Rastro binário (ver rastro.h)
+
+// Resultado completo de uma simulação
+typedef struct {
+    Algoritmo algoritmo;          // Algoritmo que gerou o resultado
+    int fluxo;                    // 1 = simulação em fluxo: métricas por vaga, sem ordem de conclusão nem intervalos
+    int quantum;                  // Quantum do Round-Robin, quantum do nível 0 do MLFQ ou latência alvo do CFS
+    int n;                        // Quantidade de processos simulados (em fluxo: admitidos até agora)
+    MetricaProcesso *metricas;    // Métricas por processo, na ordem da lista de entrada (em fluxo: por vaga)
+    int *ordem_conclusao;         // Índices dos processos na ordem em que terminaram (não usado em fluxo)
+    int n_concluidos;             // Quantidade de processos já concluídos
+    Intervalo *intervalos;        // Intervalos de execução em ordem cronológica (em fluxo: o último de cada CPU)
+    int n_intervalos;             // Quantidade de intervalos registrados (0 em fluxo)
+    int capacidade_processos;     // Capacidade alocada para os vetores por processo
+    int capacidade_intervalos;    // Capacidade alocada para os intervalos
+    int n_cpus;                   // Quantidade de CPUs simuladas
+    long long *ocupado_cpu;       // Tempo em que cada CPU executou algum processo
+    int *ultimo_intervalo_cpu;    // Último intervalo de cada CPU (-1 = nenhum), para unir continuações
+    int capacidade_cpus;          // Capacidade alocada para os vetores por CPU
+    long long n_migracoes;        // Vezes em que um processo voltou a executar em outra CPU
+    long long n_roubos;           // Processos tirados da fila de outra CPU (roubo de trabalho)
+    long long n_trocas_contexto;  // Vezes em que uma CPU passou a executar um processo diferente do anterior
+    int instante_final;           // Maior tempo de conclusão registrado
+    Histograma hist_turnaround;   // Distribuição dos turnarounds, atualizada a cada conclusão
+    Histograma hist_espera;       // Distribuição dos tempos de espera
+    Histograma hist_resposta;     // Distribuição dos tempos de resposta (primeira execução - chegada)
+    Instrumentacao instr;         // Contadores e tempos do próprio simulador (zerados sem a instrumentação)
+    ControleSimulacao *controle;  // Progresso/cancelamento (NULL = simulação sem controle externo)
+    struct EscritorRastro *rastro; // Recebe cada intervalo assim que é registrado (NULL = sem rastro)
+    int cancelada;                // 1 se a simulação foi interrompida antes de concluir todos os processos
+    int estouro_relogio;          // 1 se o relógio passaria de INT_MAX: a simulação parou ali e o resultado não vale
+    unsigned passos;              // Passos desde o início, para espaçar as publicações de progresso
+} ResultadoSimulacao;
+
+// Inicializa um resultado vazio
+void resultado_inicializar(ResultadoSimulacao *res);
+
+// Prepara o resultado para uma nova simulação da lista informada,
+// reaproveitando a memória de execuções anteriores
+void resultado_preparar(ResultadoSimulacao *res, Algoritmo algoritmo, const Processo *lista_processos, int n);
+
+// Prepara o resultado para continuar uma simulação anterior da mesma lista (ver
+// retomada.h): as métricas dos `mantidos` primeiros processos, a ordem de conclusão
+// e os intervalos ficam como estão; os demais processos e os contadores recomeçam
+void resultado_preparar_continuacao(ResultadoSimulacao *res, Algoritmo algoritmo,
+                                    const Processo *lista_processos, int n, int mantidos);
+
+// Prepara o resultado para uma simulação em fluxo, ainda sem processos
+void resultado_preparar_fluxo(ResultadoSimulacao *res, Algoritmo algoritmo);
+
+// Garante métricas e ordem de conclusão para os índices 0 a capacidade-1
+// (em fluxo, as vagas); aborta se faltar memória
+void resultado_reservar_vagas(ResultadoSimulacao *res, int capacidade);
+
+// Em fluxo: o processo ocupa a vaga `indice` e passa a ser simulado
+void resultado_admitir(ResultadoSimulacao *res, int indice, const Processo *processo);
+
+// Define a quantidade de CPUs da simulação (chamar após resultado_preparar; o padrão é 1)
+void resultado_definir_cpus(ResultadoSimulacao *res, int n_cpus);
+
+// Registra que o processo `indice` executou de `inicio` até `fim` na CPU 0
+// Intervalos contíguos do mesmo processo são unidos em um só; com um rastro
+// ligado, o intervalo também segue para ele
+void resultado_registrar_intervalo(ResultadoSimulacao *res, int indice, int inicio, int fim);
+
+// Igual a resultado_registrar_intervalo, na CPU informada
+void resultado_registrar_intervalo_cpu(ResultadoSimulacao *res, int cpu, int indice, int inicio, int fim);
+
+// Registra o término do processo `indice` no tempo `fim`, calcula suas métricas
+// e as acrescenta aos histogramas
+void resultado_registrar_conclusao(ResultadoSimulacao *res, int indice, int fim);
+
+// Publica o progresso no controle e verifica se foi pedido o cancelamento
+// Retorna 1 (e marca `cancelada`) se a simulação deve parar
+int resultado_publicar_progresso(ResultadoSimulacao *res, int tempo_atual);
+
+// Chamada a cada passo do laço de simulação: só consulta o controle a cada
+// PASSOS_POR_VERIFICACAO passos, então o custo sem controle é um teste de ponteiro
+static inline int resultado_interrompido(ResultadoSimulacao *res, int tempo_atual) {
+    if (res->controle == NULL || (++res->passos & (PASSOS_POR_VERIFICACAO - 1)) != 0) {
+        return 0;
+    }
+    return resultado_publicar_progresso(res, tempo_atual);
+}
+
+// Libera a memória do resultado
+void resultado_liberar(ResultadoSimulacao *res);
+
+#endif
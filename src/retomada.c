@@ -0,0 +1,165 @@
+/**
+ * @file retomada.c
+ * @brief Guarda, escolha e restauração dos pontos de retomada.
+ *
+ * O estado da política em cada ponto é preenchido pelo motor (ver motor.h);
+ * aqui ficam a memória dos pontos, os contadores do resultado e a escolha do
+ * ponto de onde continuar depois de uma edição da lista.
+ */
+
+#include <stdlib.h>     // malloc, free
+#include <limits.h>     // INT_MAX
+#include "retomada.h"
+
+void retomada_inicializar(RetomadaSimulacao *r) {
+    r->pontos = NULL;
+    r->n_pontos = 0;
+    r->partida = -1;
+    r->passo = 1;
+    r->proximo = 1;
+    r->guardados = 0;
+    r->orcamento = 0;
+}
+
+static void liberar_ponto(RetomadaSimulacao *r, PontoRetomada *ponto) {
+    r->guardados -= ponto->n_prontos;
+    free(ponto->prontos);
+    histograma_liberar(&ponto->hist_turnaround);
+    histograma_liberar(&ponto->hist_espera);
+    histograma_liberar(&ponto->hist_resposta);
+}
+
+// Descarta os pontos de posição par e dobra o espaçamento; o último ponto,
+// o mais útil para edições no fim da lista, sempre fica
+static void rarear(RetomadaSimulacao *r) {
+    int mantidos = 0;
+    for (int k = 0; k < r->n_pontos; k++) {
+        if ((r->n_pontos - 1 - k) % 2 == 0) {
+            r->pontos[mantidos++] = r->pontos[k];
+        } else {
+            liberar_ponto(r, &r->pontos[k]);
+        }
+    }
+    r->n_pontos = mantidos;
+    r->passo *= 2;
+}
+
+void retomada_preparar(RetomadaSimulacao *r, int n, int partida) {
+    if (partida >= r->n_pontos) {
+        partida = r->n_pontos - 1;
+    }
+    while (r->n_pontos > partida + 1) {
+        liberar_ponto(r, &r->pontos[--r->n_pontos]);
+    }
+    r->partida = partida;
+    r->passo = n / RETOMADA_MAX_PONTOS + 1;
+    r->proximo = (partida >= 0 ? r->pontos[partida].admitidos : 0) + r->passo;
+    r->orcamento = 2LL * n + RETOMADA_MAX_PONTOS;
+}
+
+PontoRetomada* retomada_novo_ponto(RetomadaSimulacao *r, int n_prontos) {
+    if (r->pontos == NULL) {
+        r->pontos = malloc(RETOMADA_MAX_PONTOS * sizeof(PontoRetomada));
+        if (r->pontos == NULL) {
+            return NULL;
+        }
+    }
+    while (r->n_pontos == RETOMADA_MAX_PONTOS
+           || (r->n_pontos > 0 && r->guardados + n_prontos > r->orcamento)) {
+        rarear(r);
+    }
+
+    PontoRetomada *ponto = &r->pontos[r->n_pontos];
+    ponto->prontos = malloc((n_prontos > 0 ? n_prontos : 1) * sizeof(ProntoRetomada));
+    if (ponto->prontos == NULL) {
+        return NULL;
+    }
+    ponto->n_prontos = n_prontos;
+    ponto->estado = 0;
+    histograma_inicializar(&ponto->hist_turnaround);
+    histograma_inicializar(&ponto->hist_espera);
+    histograma_inicializar(&ponto->hist_resposta);
+    r->n_pontos++;
+    r->guardados += n_prontos;
+    return ponto;
+}
+
+void retomada_guardar_resultado(PontoRetomada *ponto, const ResultadoSimulacao *res) {
+    ponto->n_concluidos = res->n_concluidos;
+    ponto->n_intervalos = res->n_intervalos;
+    ponto->ultimo_intervalo = res->ultimo_intervalo_cpu[0];
+    if (ponto->ultimo_intervalo >= 0) {
+        ponto->intervalo = res->intervalos[ponto->ultimo_intervalo];
+    }
+    ponto->ocupado = res->ocupado_cpu[0];
+    ponto->n_trocas_contexto = res->n_trocas_contexto;
+    ponto->instante_final = res->instante_final;
+    histograma_copiar(&ponto->hist_turnaround, &res->hist_turnaround);
+    histograma_copiar(&ponto->hist_espera, &res->hist_espera);
+    histograma_copiar(&ponto->hist_resposta, &res->hist_resposta);
+}
+
+void retomada_restaurar_resultado(const PontoRetomada *ponto, Algoritmo algoritmo,
+                                  const Processo *processos, int n, ResultadoSimulacao *res) {
+    resultado_preparar_continuacao(res, algoritmo, processos, n, ponto->admitidos);
+
+    res->n_concluidos = ponto->n_concluidos;
+    res->n_intervalos = ponto->n_intervalos;
+    res->ultimo_intervalo_cpu[0] = ponto->ultimo_intervalo;
+    if (ponto->ultimo_intervalo >= 0) {
+        res->intervalos[ponto->ultimo_intervalo] = ponto->intervalo;
+    }
+    res->ocupado_cpu[0] = ponto->ocupado;
+    res->n_trocas_contexto = ponto->n_trocas_contexto;
+    res->instante_final = ponto->instante_final;
+    histograma_copiar(&res->hist_turnaround, &ponto->hist_turnaround);
+    histograma_copiar(&res->hist_espera, &ponto->hist_espera);
+    histograma_copiar(&res->hist_resposta, &ponto->hist_resposta);
+
+    // Quem estava pronto no ponto pode ter terminado depois dele na simulação anterior
+    for (int k = 0; k < ponto->n_prontos; k++) {
+        MetricaProcesso *m = &res->metricas[ponto->prontos[k].indice];
+        m->inicio = ponto->prontos[k].inicio;
+        m->fim = -1;
+        m->turnaround = 0;
+        m->espera = 0;
+    }
+}
+
+static int processos_iguais(const Processo *a, const Processo *b) {
+    return a->pid == b->pid && a->tempo_chegada == b->tempo_chegada
+           && a->tempo_execucao == b->tempo_execucao && a->prioridade == b->prioridade;
+}
+
+int retomada_escolher(const RetomadaSimulacao *r, const Processo *anteriores, int n_anteriores,
+                      const Processo *atuais, int n_atuais) {
+    int limite = n_anteriores < n_atuais ? n_anteriores : n_atuais;
+    int diferenca = 0;
+    while (diferenca < limite && processos_iguais(&anteriores[diferenca], &atuais[diferenca])) {
+        diferenca++;
+    }
+
+    // Chegada mais cedo entre o processo removido ou trocado e o acrescentado
+    int chegada = INT_MAX;
+    if (diferenca < n_anteriores) {
+        chegada = anteriores[diferenca].tempo_chegada;
+    }
+    if (diferenca < n_atuais && atuais[diferenca].tempo_chegada < chegada) {
+        chegada = atuais[diferenca].tempo_chegada;
+    }
+
+    for (int k = r->n_pontos - 1; k >= 0; k--) {
+        if (r->pontos[k].admitidos <= diferenca && r->pontos[k].tempo < chegada) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+void retomada_liberar(RetomadaSimulacao *r) {
+    while (r->n_pontos > 0) {
+        liberar_ponto(r, &r->pontos[--r->n_pontos]);
+    }
+    free(r->pontos);
+    retomada_inicializar(r);
+}
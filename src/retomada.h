@@ -0,0 +1,101 @@
+/**
+ * @file retomada.h
+ * @brief Pontos de retomada: continuar uma simulação depois de editar a lista.
+ *
+ * Durante a simulação de uma CPU (ver simular_com_retomada), o motor guarda de
+ * tempos em tempos o estado completo no começo de uma volta do laço: relógio,
+ * processos já chegados, fila de prontos com o tempo restante de cada um e os
+ * contadores do resultado. Nesse instante a CPU está livre, então os prontos
+ * são todos os processos que já chegaram e não terminaram.
+ *
+ * Com os processos em ordem de chegada, um processo acrescentado ou removido
+ * que chega depois do instante de um ponto não muda nada do que aconteceu até
+ * ali: nenhuma decisão anterior dependeu dele. A simulação da lista editada
+ * pode então continuar do último ponto anterior à primeira diferença, e as
+ * métricas, a ordem de conclusão e os intervalos já registrados no resultado
+ * anterior continuam valendo.
+ *
+ * Os pontos ficam espaçados por quantidade de chegadas. A memória tem dois
+ * limites: RETOMADA_MAX_PONTOS pontos e, somados, 2 prontos guardados por
+ * processo; ao atingir um deles, metade dos pontos é descartada e o
+ * espaçamento dobra.
+ */
+
+#ifndef RETOMADA_H            // Evita inclusão duplicada
+#define RETOMADA_H
+
+#include "processos.h"        // Definição da struct Processo
+#include "resultado.h"        // Resultado, intervalos e histogramas
+
+// Quantidade máxima de pontos guardados de uma vez
+#define RETOMADA_MAX_PONTOS 64
+
+// Um processo pronto no instante do ponto
+typedef struct {
+    int indice;               // Posição do processo na ordem de chegada
+    int restante;             // Tempo de execução que faltava
+    int inicio;               // Primeira execução (-1 = ainda não executou)
+    int nivel;                // Estado da política (MLFQ: nível da fila)
+    long long valor;          // Estado da política (MLFQ: tempo usado do quantum; CFS: tempo virtual)
+} ProntoRetomada;
+
+// Estado da simulação no começo de uma volta do laço, com a CPU livre
+typedef struct {
+    int tempo;                    // Relógio
+    int admitidos;                // Processos (na ordem de chegada) que já tinham chegado
+    int n_prontos;                // Processos na fila de prontos
+    ProntoRetomada *prontos;      // Na ordem em que a política os guarda
+    long long estado;             // Estado global da política (MLFQ: próximo boost; CFS: menor tempo virtual)
+    // Resultado até o ponto (os intervalos e a ordem de conclusão ficam no próprio resultado)
+    int n_concluidos;
+    int n_intervalos;
+    int ultimo_intervalo;         // Último intervalo da CPU (-1 = nenhum)
+    Intervalo intervalo;          // Conteúdo dele no ponto (depois pode ter sido estendido)
+    long long ocupado;
+    long long n_trocas_contexto;
+    int instante_final;
+    Histograma hist_turnaround;
+    Histograma hist_espera;
+    Histograma hist_resposta;
+} PontoRetomada;
+
+// Pontos de retomada de uma sequência de simulações com o mesmo algoritmo e parâmetros
+typedef struct RetomadaSimulacao {
+    PontoRetomada *pontos;        // Em ordem cronológica
+    int n_pontos;
+    int partida;                  // Ponto de onde a simulação atual continua (-1 = do início)
+    int passo;                    // Chegadas entre dois pontos
+    int proximo;                  // Chegadas a partir das quais o próximo ponto é guardado
+    long long guardados;          // Prontos guardados em todos os pontos
+    long long orcamento;          // Limite de `guardados`
+} RetomadaSimulacao;
+
+// Inicializa sem pontos, sem alocar memória
+void retomada_inicializar(RetomadaSimulacao *r);
+
+// Prepara uma simulação de n processos que continua do ponto `partida`
+// (-1 = do início): descarta os pontos seguintes, que deixam de valer
+void retomada_preparar(RetomadaSimulacao *r, int n, int partida);
+
+// Acrescenta um ponto com espaço para n_prontos prontos, descartando metade dos
+// pontos antigos se algum limite for atingido; retorna NULL se faltar memória
+PontoRetomada* retomada_novo_ponto(RetomadaSimulacao *r, int n_prontos);
+
+// Guarda no ponto os contadores do resultado (simulação de uma CPU)
+void retomada_guardar_resultado(PontoRetomada *ponto, const ResultadoSimulacao *res);
+
+// Prepara `res`, que contém o resultado da simulação em que o ponto foi guardado,
+// para continuar dali sobre a lista informada (em ordem de chegada)
+void retomada_restaurar_resultado(const PontoRetomada *ponto, Algoritmo algoritmo,
+                                  const Processo *processos, int n, ResultadoSimulacao *res);
+
+// Escolhe o ponto de onde continuar a simulação da lista `atuais`, sendo `anteriores`
+// a lista simulada quando os pontos foram guardados (ambas em ordem de chegada):
+// o último ponto anterior à chegada do primeiro processo diferente. Retorna -1 se não houver
+int retomada_escolher(const RetomadaSimulacao *r, const Processo *anteriores, int n_anteriores,
+                      const Processo *atuais, int n_atuais);
+
+// Libera os pontos
+void retomada_liberar(RetomadaSimulacao *r);
+
+#endif
@@ -2,303 +2,965 @@
  * @file simulador.c
  * @brief Implementação dos algoritmos de escalonamento de processos.
  *
- * Contém a lógica dos algoritmos FIFO, SJF, Round-Robin e Prioridade.
+ * Contém a lógica dos algoritmos FIFO, SJF, Round-Robin, Prioridade, MLFQ, CFS e SRTF.
  * Cada função simula o comportamento de escalonamento com base na lista
- * de processos atual e retorna os resultados em forma de texto.
+ * de processos atual e preenche um ResultadoSimulacao com as métricas de
+ * cada processo e os intervalos de execução (sem formatar texto).
+ * O laço de eventos é o mesmo para todos (ver motor.h); cada algoritmo só
+ * define a sua política: a fila de prontos, a escolha e o tamanho da fatia.
+ * A função executar_X de cada algoritmo monta o estado da política e roda o
+ * motor, tanto sobre uma lista completa (simular_X) quanto em fluxo
+ * (simular_em_fluxo) ou guardando pontos de retomada (simular_com_retomada).
  *
  * @author Carolina Mafra Sada, Amanda Victória Almeida SIlva
  */
 
-#include <stdio.h>      // Biblioteca padrão para entrada/saída 
 #include <stdlib.h>     // Biblioteca para alocação dinâmica 
-#include <string.h>     // Biblioteca para manipulação de strings 
+#include <string.h>     // strcmp para busca de algoritmo por nome
+#include <limits.h>     // INT_MAX
 #include "simulador.h"  // Header com as declarações das funções deste arquivo
 #include "processos.h"  // Header com a definição da struct Processo
+#include "filas.h"      // Heap de mínimo, fila circular e árvore rubro-negra usados como fila de prontos
+#include "motor.h"      // Laço de eventos comum, parametrizado pela política
+
+// Retorna a ordem de chegada informada pelo chamador ou, se ela for NULL,
+// monta uma nova em `*alocada` (que o chamador libera com free)
+static const int* obter_ordem(const Processo *lista_processos, int n, const int *ordem, int **alocada) {
+    *alocada = NULL;
+    if (ordem != NULL) {
+        return ordem;
+    }
+    *alocada = malloc((n > 0 ? n : 1) * sizeof(int));
+    ordenar_por_chegada(lista_processos, n, *alocada);
+    return *alocada;
+}
+
+// Prepara o motor para simular a lista de processos com a política informada
+SEMPRE_INLINE void motor_inicializar(Motor *m, const Politica *p, const Processo *lista_processos, int n,
+                                     ResultadoSimulacao *res) {
+    m->processos = lista_processos;
+    m->n = n;
+    m->restante = p->preemptiva ? malloc((n > 0 ? n : 1) * sizeof(int)) : NULL;
+    m->res = res;
+    m->politica = NULL;
+    m->fonte = NULL;
+    m->vagas = NULL;
+    m->livres = NULL;
+    m->retomada = NULL;
+}
+
+// Prepara o motor para simular em fluxo, já com as primeiras vagas e o primeiro processo da fonte
+static void motor_inicializar_fluxo(Motor *m, const Politica *p, FonteProcessos *fonte,
+                                    FuncaoConclusao concluiu, void *contexto, ResultadoSimulacao *res) {
+    m->processos = NULL;
+    m->n = 0;
+    m->restante = NULL;
+    m->res = res;
+    m->politica = NULL;
+    m->fonte = fonte;
+    m->vagas = NULL;
+    m->livres = NULL;
+    m->n_livres = 0;
+    m->erro_fonte = 0;
+    m->concluiu = concluiu;
+    m->contexto = contexto;
+    m->retomada = NULL;
+    motor_crescer_vagas(m, p->preemptiva);
+    motor_ler_fonte(m);
+}
+
+static void motor_finalizar(Motor *m) {
+    free(m->restante);
+    free(m->vagas);
+    free(m->livres);
+}
+
+// Fatia de quem só pode ser interrompido por uma chegada (Prioridade e SRTF)
+static int fatia_ate_chegada(Motor *m, int i, int tempo, int proxima_chegada) {
+    return proxima_chegada >= 0 ? proxima_chegada - tempo : m->restante[i];
+}
+
+// FIFO: atende na ordem de chegada, sem fila de prontos
+static const Politica politica_fifo = {
+    .em_ordem_de_chegada = 1,
+};
+
+SEMPRE_INLINE void executar_fifo(Motor *m, const int *ordem, const ModoMotor modo) {
+    executar_motor(&politica_fifo, m, ordem, modo);
+}
 
 // Simula o escalonamento FIFO (primeiro a chegar, primeiro a ser executado, FIFO)
-void simular_FIFO(Processo *lista_processos, int n, char *output_buffer) {
-    int tempo_atual = 0;                // Marca o tempo atual do sistema
-    char temp[256];                     // Buffer temporário para formatar a saída
-    
-    // Cabeçalho da simulação
-    strcpy(output_buffer, "Simulação FIFO:\n");
-    strcat(output_buffer, "PID\tInício\tFim\tTurnaround\tEspera\n");
-
-    // Ordena os processos por tempo de chegada
-    for (int i = 0; i < n - 1; i++) {
-        for (int j = 0; j < n - i - 1; j++) {
-            if (lista_processos[j].tempo_chegada > lista_processos[j + 1].tempo_chegada) {
-                Processo temp = lista_processos[j];
-                lista_processos[j] = lista_processos[j + 1];
-                lista_processos[j + 1] = temp;
-            }
-        }
+// Os processos são percorridos em ordem de chegada sem alterar a lista original
+void simular_FIFO(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res) {
+    int *ordem_alocada;                         // Ordem montada aqui quando o chamador não fornece uma
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada); // Índices em ordem de chegada
+    Motor m;
+
+    resultado_preparar(res, ALGORITMO_FIFO, lista_processos, n);
+    motor_inicializar(&m, &politica_fifo, lista_processos, n, res);
+    executar_fifo(&m, ordem, MOTOR_LISTA);
+
+    motor_finalizar(&m);
+    free(ordem_alocada);
+}
+
+// Fila de prontos por (chave, PID) do SJF e da Prioridade: o heap ou, se
+// ativado na compilação (ver CONJUNTO_PRONTO_ATIVO), o conjunto de prontos em vetores.
+// O conjunto tem capacidade fixa e não é percorrido pelos pontos de retomada,
+// então só é usado na simulação da lista completa
+typedef struct {
+    int vetorial;                       // 1 = usa `conjunto`, 0 = usa `heap`
+    HeapMin heap;
+    ConjuntoPronto conjunto;
+} FilaPorChave;
+
+static void prontos_inicializar(FilaPorChave *fila, int n, ModoMotor modo) {
+    fila->vetorial = CONJUNTO_PRONTO_ATIVO && modo == MOTOR_LISTA && n <= LIMITE_CONJUNTO_PRONTO;
+    if (fila->vetorial) {
+        conjunto_inicializar(&fila->conjunto, n);
+    } else {
+        heap_inicializar(&fila->heap, n);
     }
+}
 
-    for (int i = 0; i < n; i++) {
-        // Se o processo chegou depois do tempo atual, o sistema espera
-        if (lista_processos[i].tempo_chegada > tempo_atual) {
-            tempo_atual = lista_processos[i].tempo_chegada;
-        }
+static void prontos_inserir(FilaPorChave *fila, int chave, int pid, int indice) {
+    if (fila->vetorial) {
+        conjunto_inserir(&fila->conjunto, chave, pid, indice);
+    } else {
+        heap_inserir(&fila->heap, chave, pid, indice);
+    }
+}
 
-        int inicio = tempo_atual;                                // Tempo em que o processo começa
-        int fim = inicio + lista_processos[i].tempo_execucao;    // Tempo em que o processo termina
-        int turnaround = fim - lista_processos[i].tempo_chegada; // Tempo total que o processo levou (chegada até término)
-        int espera = inicio - lista_processos[i].tempo_chegada;  // Quanto tempo o processo esperou na fila
+// Remove o índice de menor (chave, pid); não deve ser chamada com a fila vazia
+static int prontos_remover_min(FilaPorChave *fila) {
+    return fila->vetorial ? conjunto_remover_min(&fila->conjunto).indice
+                          : heap_remover_min(&fila->heap).indice;
+}
 
-        // Formata e armazena a linha do processo no buffer de saída
-        snprintf(temp, sizeof(temp), "%-6d\t%-7d\t%-7d\t%-11d\t%-6d\n",
-                 lista_processos[i].pid,
-                 inicio,
-                 fim,
-                 turnaround,
-                 espera);
+static int prontos_tamanho(const FilaPorChave *fila) {
+    return fila->vetorial ? fila->conjunto.tamanho : fila->heap.tamanho;
+}
 
-        strcat(output_buffer, temp);      // Adiciona a linha ao resultado final
+static void prontos_liberar(FilaPorChave *fila) {
+    if (fila->vetorial) {
+        conjunto_liberar(&fila->conjunto);
+    } else {
+        heap_liberar(&fila->heap);
+    }
+}
 
-        tempo_atual = fim;                // Atualiza o tempo atual para o fim do processo
+// Pontos de retomada de quem guarda os prontos em um heap: a ordem dos itens
+// não importa, pois `chegou` os reinsere pela mesma chave
+static void heap_salvar(const HeapMin *heap, PontoRetomada *ponto) {
+    for (int k = 0; k < heap->tamanho; k++) {
+        ponto->prontos[k].indice = heap->itens[k].indice;
     }
 }
 
-// Simula o escalonamento FIFO (primeiro a chegar, primeiro a ser executado)
-void simular_sjf(Processo *lista_processos, int n, char *output_buffer) {
-    int tempo_atual = 0;                        // Tempo atual da simulação
-    int concluídos = 0;                         // Contador de processos finalizados
-    int *finalizado = calloc(n, sizeof(int));  // Vetor que marca quais processos já foram executados
-    char temp[256];                            // Buffer temporário para formatar a saída
+static void por_chave_salvar(const Motor *m, PontoRetomada *ponto) {
+    heap_salvar(&((const FilaPorChave*)m->politica)->heap, ponto);
+}
 
-    // Cabeçalho da simulação
-    strcpy(output_buffer, "Simulação SJF:\n");
-    strcat(output_buffer, "PID\tInício\tFim\tTurnaround\tEspera\n");
+static int por_chave_tamanho(const Motor *m) {
+    return prontos_tamanho(m->politica);
+}
 
-    while (concluídos < n) {
-        int menor_tempo = __INT_MAX__;  // Tempo de execução mais curto
-        int indice = -1;                // Índice do processo escolhido
+static int por_chave_escolher(Motor *m) {
+    return prontos_remover_min(m->politica);
+}
 
-        for (int i = 0; i < n; i++) {
-            // Seleciona o menor tempo entre os processos que já chegaram e não foram finalizados
-            if (!finalizado[i] && lista_processos[i].tempo_chegada <= tempo_atual) {
-                if (lista_processos[i].tempo_execucao < menor_tempo) {
-                    menor_tempo = lista_processos[i].tempo_execucao; // Atualiza o menor tempo encontrado
-                    indice = i;                                      // Salva o índice do processo com menor tempo
-                }
-            }
-        }
+// SJF: prontos ordenados por tempo de execução
+static void sjf_chegou(Motor *m, int i) {
+    prontos_inserir(m->politica, m->processos[i].tempo_execucao, m->processos[i].pid, i);
+}
 
-        // Se nenhum processo está pronto, incrementa o tempo
-        if (indice == -1) {
-            tempo_atual++;  // Avança o tempo da simulação
-            continue;       // Volta ao início do while
-        }
+static const Politica politica_sjf = {
+    .chegou = sjf_chegou,
+    .tamanho = por_chave_tamanho,
+    .escolher = por_chave_escolher,
+    .salvar = por_chave_salvar,
+};
 
-        int inicio = tempo_atual;                                       // Tempo que o processo começa a ser executado
-        int fim = inicio + lista_processos[indice].tempo_execucao;      // Tempo que o processo termina
-        int turnaround = fim - lista_processos[indice].tempo_chegada;   // Tempo total entre chegada e fim
-        int espera = inicio - lista_processos[indice].tempo_chegada;    // Tempo que o processo ficou esperando na fila
+SEMPRE_INLINE void executar_sjf(Motor *m, const int *ordem, const ModoMotor modo) {
+    FilaPorChave prontos;                       // Fila de prontos ordenada por (tempo de execução, PID)
 
-        snprintf(temp, sizeof(temp), "%-6d\t%-7d\t%-7d\t%-11d\t%-6d\n",
-                 lista_processos[indice].pid,
-                 inicio,
-                 fim,
-                 turnaround,
-                 espera);
+    prontos_inicializar(&prontos, m->n, modo);
+    m->politica = &prontos;
+    executar_motor(&politica_sjf, m, ordem, modo);
+    prontos_liberar(&prontos);  // Libera memória
+}
 
-        strcat(output_buffer, temp);  // Adiciona essa linha formatada ao buffer de saída
+// Simula o escalonamento SJF (menor tempo de execução primeiro, não-preemptivo)
+// Os processos entram na fila de prontos, ordenada por tempo de execução, à medida que chegam
+void simular_sjf(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res) {
+    int *ordem_alocada;                         // Ordem montada aqui quando o chamador não fornece uma
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada); // Índices em ordem de chegada
+    Motor m;
 
-        tempo_atual = fim;            // Atualiza o tempo da simulação para o fim do processo executado
-        finalizado[indice] = 1;       // Marca o processo como concluído
-        concluídos++;                 // Atualiza o contador de processos finalizados
-    }
+    resultado_preparar(res, ALGORITMO_SJF, lista_processos, n);
+    motor_inicializar(&m, &politica_sjf, lista_processos, n, res);
+    executar_sjf(&m, ordem, MOTOR_LISTA);
 
-    free(finalizado);  // Libera memória
+    motor_finalizar(&m);
+    free(ordem_alocada);
 }
 
-// Simula o escalonamento round-robin com quantum fixo de 2
-void simular_round_robin(Processo *lista_processos, int n, char *output_buffer) {
-    int quantum = 2;  // Tempo fixo de fatia para cada processo
-    int tempo_atual = 0;  // Relógio da simulação, em unidades de tempo
-    // Array para armazenar o tempo restante de execução de cada processo
-    int *tempo_restante = malloc(n * sizeof(int)); 
-    char temp[256];  // Buffer temporário para montar strings de saída
+// Round-Robin: fila circular em ordem de atendimento e fatia fixa
+typedef struct {
+    FilaCircular prontos;
+    int quantum;
+} EstadoRR;
 
-    // Inicializa o tempo restante com o tempo total de execução de cada processo
-    for (int i = 0; i < n; i++) {
-        tempo_restante[i] = lista_processos[i].tempo_execucao;
-    }
-
-    int processos_restantes = n;  // Quantidade de processos ainda não concluídos
-
-    // Inicializa a saída com cabeçalho da simulação
-    strcpy(output_buffer, "Simulação Round-Robin (Q=2):\n");
-    strcat(output_buffer, "Execução passo a passo:\n");
-
-    // Arrays para controlar o tempo de início de execução e processos finalizados
-    int *inicio_execucao = calloc(n, sizeof(int));  // Inicializa com zero
-    int *terminado = calloc(n, sizeof(int));        // Inicializa com zero
-
-    // Buffer para o resumo final das métricas (turnaround, espera)
-    char resumo_final[2048] = "";
-    strcat(resumo_final, "Resumo Final:\n");
-    strcat(resumo_final, "PID\tInício\tFim\tTurnaround\tEspera\n");
-
-    // Loop principal enquanto houver processos a executar
-    while (processos_restantes > 0) {
-        int executou_ao_menos_um = 0;  // Flag para verificar se algum processo rodou nesta volta
-
-        for (int i = 0; i < n; i++) {
-            // Verifica se o processo está pronto para rodar (tempo restante > 0 e já chegou)
-            if (tempo_restante[i] > 0 && lista_processos[i].tempo_chegada <= tempo_atual) {
-                executou_ao_menos_um = 1;
-
-                // Registra o tempo de início da primeira execução do processo
-                // Problema: se começar no tempo 0, condição pode falhar (ver resposta técnica)
-                if (!inicio_execucao[i]) {
-                    inicio_execucao[i] = (tempo_atual < lista_processos[i].tempo_chegada) ?
-                                          lista_processos[i].tempo_chegada : tempo_atual;
-                }
-
-                // Define quanto tempo o processo vai rodar: quantum ou tempo restante se menor
-                int tempo_exec = (tempo_restante[i] < quantum) ? tempo_restante[i] : quantum;
-
-                // Ajusta o tempo inicial para o tempo de chegada caso seja maior que tempo atual
-                int tempo_inicio = (tempo_atual < lista_processos[i].tempo_chegada) ?
-                                    lista_processos[i].tempo_chegada : tempo_atual;
-
-                // Atualiza o tempo atual somando o tempo de execução desta fatia
-                tempo_atual = tempo_inicio + tempo_exec;
-
-                // Decrementa o tempo restante do processo
-                tempo_restante[i] -= tempo_exec;
-
-                // Registra no log a execução deste intervalo
-                snprintf(temp, sizeof(temp),
-                         "Tempo %d-%d: PID %d (restante: %d)\n",
-                         tempo_inicio, tempo_atual,
-                         lista_processos[i].pid,
-                         tempo_restante[i]);
-                strcat(output_buffer, temp);
-
-                // Caso o processo tenha terminado nesta execução
-                if (tempo_restante[i] == 0 && !terminado[i]) {
-                    int fim = tempo_atual;  // Tempo final do processo
-                    int turnaround = fim - lista_processos[i].tempo_chegada;  // Tempo total no sistema
-                    int espera = turnaround - lista_processos[i].tempo_execucao;  // Tempo de espera na fila
-
-                    // Registra as métricas finais no resumo
-                    snprintf(temp, sizeof(temp), "%-6d\t%-7d\t%-7d\t%-11d\t%-6d\n",
-                             lista_processos[i].pid,
-                             inicio_execucao[i],
-                             fim,
-                             turnaround,
-                             espera);
-                    strcat(resumo_final, temp);
-
-                    terminado[i] = 1;          // Marca processo como terminado
-                    processos_restantes--;      // Decrementa contador de processos restantes
-                }
-            }
-        }
+static void rr_chegou(Motor *m, int i) {
+    fila_inserir(&((EstadoRR*)m->politica)->prontos, i);
+}
 
-        // Se nenhum processo foi executado neste ciclo, incrementa o tempo para simular espera
-        if (!executou_ao_menos_um) {
-            tempo_atual++;
-        }
+static int rr_tamanho(const Motor *m) {
+    return ((const EstadoRR*)m->politica)->prontos.tamanho;
+}
+
+static int rr_escolher(Motor *m) {
+    return fila_remover(&((EstadoRR*)m->politica)->prontos);
+}
+
+// A ordem da fila é guardada do início ao fim
+static void rr_salvar(const Motor *m, PontoRetomada *ponto) {
+    const FilaCircular *fila = &((const EstadoRR*)m->politica)->prontos;
+    for (int k = 0; k < fila->tamanho; k++) {
+        ponto->prontos[k].indice = fila->itens[(fila->inicio + k) % fila->capacidade];
     }
+}
 
-    // Adiciona o resumo final à saída principal
-    strcat(output_buffer, "\n");
-    strcat(output_buffer, resumo_final);
+static int rr_fatia(Motor *m, int i, int tempo, int proxima_chegada) {
+    (void)i;
+    (void)tempo;
+    (void)proxima_chegada;
+    return ((EstadoRR*)m->politica)->quantum;
+}
+
+// Quem não terminou volta para o final da fila, depois de quem chegou durante a fatia
+static const Politica politica_rr = {
+    .preemptiva = 1,
+    .chegou = rr_chegou,
+    .tamanho = rr_tamanho,
+    .escolher = rr_escolher,
+    .fatia = rr_fatia,
+    .devolver = rr_chegou,
+    .salvar = rr_salvar,
+};
+
+SEMPRE_INLINE void executar_rr(Motor *m, const int *ordem, const ModoMotor modo, int quantum) {
+    EstadoRR estado;
+
+    if (quantum < 1) {
+        quantum = 1;  // Um quantum nulo ou negativo nunca faria a simulação avançar
+    }
+    estado.quantum = quantum;
+    m->res->quantum = quantum;
+    fila_inicializar(&estado.prontos, m->n);
+    m->politica = &estado;
+    executar_motor(&politica_rr, m, ordem, modo);
+    fila_liberar(&estado.prontos);
+}
+
+// Simula o escalonamento round-robin com o quantum informado
+// Apenas processos que já chegaram e ainda não terminaram ficam na fila de prontos
+void simular_round_robin(const Processo *lista_processos, int n, const int *ordem_chegada, int quantum, ResultadoSimulacao *res) {
+    int *ordem_alocada;                         // Ordem montada aqui quando o chamador não fornece uma
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada); // Índices em ordem de chegada
+    Motor m;
+
+    resultado_preparar(res, ALGORITMO_ROUND_ROBIN, lista_processos, n);
+    motor_inicializar(&m, &politica_rr, lista_processos, n, res);
+    executar_rr(&m, ordem, MOTOR_LISTA, quantum);
+
+    motor_finalizar(&m);
+    free(ordem_alocada);
+}
+
+// Prioridade: prontos ordenados por prioridade; quem é interrompido volta com a mesma chave
+static void prioridade_chegou(Motor *m, int i) {
+    prontos_inserir(m->politica, m->processos[i].prioridade, m->processos[i].pid, i);
+}
+
+static const Politica politica_prioridade = {
+    .preemptiva = 1,
+    .chegou = prioridade_chegou,
+    .tamanho = por_chave_tamanho,
+    .escolher = por_chave_escolher,
+    .fatia = fatia_ate_chegada,
+    .devolver = prioridade_chegou,
+    .salvar = por_chave_salvar,
+};
+
+SEMPRE_INLINE void executar_prioridade(Motor *m, const int *ordem, const ModoMotor modo) {
+    FilaPorChave prontos;                            // Fila de prontos ordenada por (prioridade, PID)
+
+    prontos_inicializar(&prontos, m->n, modo);
+    m->politica = &prontos;
+    executar_motor(&politica_prioridade, m, ordem, modo);
+    prontos_liberar(&prontos);
+}
+
+// Simula o escalonamento por prioridade preemptiva (menor valor = maior prioridade)
+// Como a preempção só pode ocorrer quando um novo processo chega, o processo escolhido
+// executa de uma vez até terminar ou até a próxima chegada
+void simular_prioridade(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res) {
+    int *ordem_alocada;                         // Ordem montada aqui quando o chamador não fornece uma
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada); // Índices em ordem de chegada
+    Motor m;
+
+    resultado_preparar(res, ALGORITMO_PRIORIDADE, lista_processos, n);
+    motor_inicializar(&m, &politica_prioridade, lista_processos, n, res);
+    executar_prioridade(&m, ordem, MOTOR_LISTA);
 
     // Libera memória alocada dinamicamente
-    free(tempo_restante);
-    free(inicio_execucao);
-    free(terminado);
+    motor_finalizar(&m);
+    free(ordem_alocada);
 }
 
-void simular_prioridade(Processo *lista_processos, int n, char *output_buffer) {
-    int tempo_atual = 0;  // Relógio da simulação em unidades de tempo
-    int *tempo_restante = malloc(n * sizeof(int));  // Tempo restante para cada processo
-    int *finalizado = calloc(n, sizeof(int));       // Flag para processos concluídos
-    int processos_restantes = n;                     // Contador de processos não finalizados
-    char temp[256];                                  // Buffer temporário para saída
+// SRTF: heap por tempo restante; quem é interrompido volta com o tempo que falta
+static void srtf_chegou(Motor *m, int i) {
+    heap_inserir(m->politica, m->restante[i], m->processos[i].pid, i);
+}
 
-    // Inicializa tempo restante com tempo total de execução dos processos
-    for (int i = 0; i < n; i++) {
-        tempo_restante[i] = lista_processos[i].tempo_execucao;
+static int srtf_tamanho(const Motor *m) {
+    return ((const HeapMin*)m->politica)->tamanho;
+}
+
+static int srtf_escolher(Motor *m) {
+    return heap_remover_min(m->politica).indice;
+}
+
+static void srtf_salvar(const Motor *m, PontoRetomada *ponto) {
+    heap_salvar(m->politica, ponto);
+}
+
+static const Politica politica_srtf = {
+    .preemptiva = 1,
+    .chegou = srtf_chegou,
+    .tamanho = srtf_tamanho,
+    .escolher = srtf_escolher,
+    .fatia = fatia_ate_chegada,
+    .devolver = srtf_chegou,
+    .salvar = srtf_salvar,
+};
+
+SEMPRE_INLINE void executar_srtf(Motor *m, const int *ordem, const ModoMotor modo) {
+    HeapMin prontos;                                 // Fila de prontos ordenada por (tempo restante, PID)
+
+    heap_inicializar(&prontos, m->n);
+    m->politica = &prontos;
+    executar_motor(&politica_srtf, m, ordem, modo);
+    heap_liberar(&prontos);
+}
+
+// Função para simular o algoritmo SRTF (Shortest Remaining Time First, preemptivo)
+// Orientada a eventos como simular_prioridade: a fila de prontos é um heap por tempo
+// restante e só uma chegada pode interromper o processo em execução
+void simular_srtf(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res) {
+    int *ordem_alocada;
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada);
+    Motor m;
+
+    resultado_preparar(res, ALGORITMO_SRTF, lista_processos, n);
+    motor_inicializar(&m, &politica_srtf, lista_processos, n, res);
+    executar_srtf(&m, ordem, MOTOR_LISTA);
+
+    motor_finalizar(&m);
+    free(ordem_alocada);
+}
+
+void mlfq_config_padrao(ConfigMLFQ *config, int quantum) {
+    if (quantum < 1) {
+        quantum = 1;
     }
+    config->n_niveis = 3;
+    for (int l = 0; l < MAX_NIVEIS_MLFQ; l++) {
+        config->quanta[l] = quantum << (l < 2 ? l : 2);
+    }
+    config->periodo_boost = 50 * quantum;
+}
+
+// Fila de um nível do MLFQ, encadeada pelo vetor `proximo` compartilhado entre os
+// níveis (cada processo está em no máximo uma fila). Juntar duas filas é O(1)
+typedef struct {
+    int primeiro;               // Primeiro processo da fila (-1 = vazia)
+    int ultimo;                 // Último processo da fila
+} FilaNivel;
+
+static void nivel_inserir(FilaNivel *fila, int *proximo, int i) {
+    proximo[i] = -1;
+    if (fila->ultimo < 0) {
+        fila->primeiro = i;
+    } else {
+        proximo[fila->ultimo] = i;
+    }
+    fila->ultimo = i;
+}
+
+static int nivel_remover(FilaNivel *fila, const int *proximo) {
+    int i = fila->primeiro;
+    fila->primeiro = proximo[i];
+    if (fila->primeiro < 0) {
+        fila->ultimo = -1;
+    }
+    return i;
+}
 
-    // Cabeçalho da saída
-    strcpy(output_buffer, "Simulação Prioridade Preemptiva:\n");
-    strcat(output_buffer, "Execução passo a passo:\n");
+// MLFQ: filas encadeadas por nível e mapa de bits dos níveis ocupados
+typedef struct {
+    int n_niveis;
+    int quanta[MAX_NIVEIS_MLFQ];
+    FilaNivel filas[MAX_NIVEIS_MLFQ];           // Uma fila de prontos por nível
+    unsigned ocupados;                          // Bit l ligado = fila do nível l não vazia
+    int n_prontos;                              // Processos em todas as filas
+    int *proximo;                               // Encadeamento das filas dos níveis
+    int *usado;                                 // Tempo já usado do quantum do nível atual
+    int *epoca;                                 // Boost em que `usado` foi atualizado pela última vez
+    int epoca_atual;                            // Quantidade de boosts já ocorridos
+    int periodo;                                // Período do boost (0 = sem boost)
+    long long proximo_boost;                    // Instante do próximo boost (ignorado se periodo == 0); pode passar de INT_MAX
+    int nivel;                                  // Nível do processo em execução
+} EstadoMLFQ;
+
+// Processos que chegam entram no nível 0, sem tempo usado (a vaga pode ter sido de outro processo)
+static void mlfq_chegou(Motor *m, int i) {
+    EstadoMLFQ *e = m->politica;
+    e->usado[i] = 0;
+    e->epoca[i] = e->epoca_atual;
+    nivel_inserir(&e->filas[0], e->proximo, i);
+    e->ocupados |= 1u;
+    e->n_prontos++;
+}
+
+static int mlfq_tamanho(const Motor *m) {
+    return ((const EstadoMLFQ*)m->politica)->n_prontos;
+}
 
-    // Buffer para resumo final de métricas
-    char resumo_final[2048] = "";
-    strcat(resumo_final, "\nResumo Final:\n");
-    strcat(resumo_final, "PID\tInício\tFim\tTurnaround\tEspera\n");
+// Nível mais prioritário com processos: primeiro bit ligado, O(1)
+static int mlfq_escolher(Motor *m) {
+    EstadoMLFQ *e = m->politica;
+    int l = __builtin_ctz(e->ocupados);
+    int i = nivel_remover(&e->filas[l], e->proximo);
+    if (e->filas[l].primeiro < 0) {
+        e->ocupados &= ~(1u << l);
+    }
+    e->n_prontos--;
+    e->nivel = l;
 
-    int *inicio_execucao = calloc(n, sizeof(int));  // Registra o tempo da primeira execução de cada processo
+    // O tempo usado no nível vale só até o próximo boost
+    if (e->epoca[i] != e->epoca_atual) {
+        e->epoca[i] = e->epoca_atual;
+        e->usado[i] = 0;
+    }
+    return i;
+}
 
-    // Loop principal até todos os processos terminarem
-    while (processos_restantes > 0) {
-        int menor_prioridade = __INT_MAX__;  // Inicializa com maior inteiro possível
-        int indice = -1;                     // Índice do processo escolhido para executar
+// Executa até esgotar o quantum do nível, chegar alguém de nível superior
+// (só interrompe níveis abaixo do 0) ou ocorrer o boost
+static int mlfq_fatia(Motor *m, int i, int tempo, int proxima_chegada) {
+    const EstadoMLFQ *e = m->politica;
+    int l = e->nivel;
+    int tempo_exec = e->quanta[l] - e->usado[i];
+    if (l > 0 && proxima_chegada >= 0 && proxima_chegada - tempo < tempo_exec) {
+        tempo_exec = proxima_chegada - tempo;
+    }
+    if (e->periodo > 0 && e->proximo_boost - tempo < tempo_exec) {
+        tempo_exec = (int)(e->proximo_boost - tempo);
+    }
+    return tempo_exec;
+}
+
+static void mlfq_executou(Motor *m, int i, int executado) {
+    ((EstadoMLFQ*)m->politica)->usado[i] += executado;
+}
 
-        // Busca processo pronto com menor prioridade
-        for (int i = 0; i < n; i++) {
-            if (!finalizado[i] && lista_processos[i].tempo_chegada <= tempo_atual) {
-                if (lista_processos[i].prioridade < menor_prioridade) {
-                    menor_prioridade = lista_processos[i].prioridade;
-                    indice = i;
-                }
-            }
+// Esgotou o quantum: desce um nível (o último nível funciona como Round-Robin)
+static void mlfq_devolver(Motor *m, int i) {
+    EstadoMLFQ *e = m->politica;
+    int l = e->nivel;
+    if (e->usado[i] == e->quanta[l]) {
+        if (l + 1 < e->n_niveis) {
+            l++;
         }
+        e->usado[i] = 0;
+    }
+    nivel_inserir(&e->filas[l], e->proximo, i);
+    e->ocupados |= 1u << l;
+    e->n_prontos++;
+}
 
-        // Nenhum processo disponível, avança tempo
-        if (indice == -1) {
-            tempo_atual++;
+// Boost periódico: as filas dos níveis inferiores são emendadas no fim do
+// nível 0, em ordem - O(níveis); o tempo usado é zerado de forma preguiçosa.
+// Depois de um salto ocioso as filas estão vazias e só o próximo boost avança
+static void mlfq_tempo_avancou(Motor *m, int tempo) {
+    EstadoMLFQ *e = m->politica;
+    if (e->periodo == 0 || tempo < e->proximo_boost) {
+        return;
+    }
+    for (int k = 1; k < e->n_niveis; k++) {
+        if (e->filas[k].primeiro < 0) {
             continue;
         }
-
-        // Marca início da execução se for a primeira vez
-        if (!inicio_execucao[indice]) {
-            inicio_execucao[indice] = tempo_atual;
+        if (e->filas[0].ultimo < 0) {
+            e->filas[0].primeiro = e->filas[k].primeiro;
+        } else {
+            e->proximo[e->filas[0].ultimo] = e->filas[k].primeiro;
         }
+        e->filas[0].ultimo = e->filas[k].ultimo;
+        e->filas[k].primeiro = e->filas[k].ultimo = -1;
+    }
+    e->ocupados = e->filas[0].primeiro >= 0 ? 1u : 0u;
+    e->epoca_atual++;
+    e->proximo_boost = (long long)(tempo / e->periodo + 1) * e->periodo;
+}
 
-        // Log da execução da unidade de tempo do processo escolhido
-        snprintf(temp, sizeof(temp), "Tempo %d: PID %d (restante: %d)\n",
-                 tempo_atual, lista_processos[indice].pid, tempo_restante[indice] - 1);
-        strcat(output_buffer, temp);
-
-        // Executa um passo da unidade de tempo
-        tempo_restante[indice]--;
-        tempo_atual++;
-
-        // Processo terminou?
-        if (tempo_restante[indice] == 0) {
-            int fim = tempo_atual;
-            int turnaround = fim - lista_processos[indice].tempo_chegada;
-            int espera = turnaround - lista_processos[indice].tempo_execucao;
-
-            // Registra métricas finais no resumo
-            snprintf(temp, sizeof(temp), "%-6d\t%-7d\t%-7d\t%-11d\t%-6d\n",
-                     lista_processos[indice].pid,
-                     inicio_execucao[indice],
-                     fim,
-                     turnaround,
-                     espera);
-
-            strcat(resumo_final, temp);
-            finalizado[indice] = 1;
-            processos_restantes--;
+static void mlfq_crescer(Motor *m, int anterior) {
+    EstadoMLFQ *e = m->politica;
+    (void)anterior;
+    e->proximo = realloc(e->proximo, m->n * sizeof(int));
+    e->usado = realloc(e->usado, m->n * sizeof(int));
+    e->epoca = realloc(e->epoca, m->n * sizeof(int));
+    if (e->proximo == NULL || e->usado == NULL || e->epoca == NULL) {
+        abort();
+    }
+}
+
+// Guarda as filas do nível 0 ao último; o tempo usado de outra época já vale 0
+static void mlfq_salvar(const Motor *m, PontoRetomada *ponto) {
+    const EstadoMLFQ *e = m->politica;
+    int k = 0;
+    for (int l = 0; l < e->n_niveis; l++) {
+        for (int i = e->filas[l].primeiro; i >= 0; i = e->proximo[i]) {
+            ponto->prontos[k].indice = i;
+            ponto->prontos[k].nivel = l;
+            ponto->prontos[k].valor = e->epoca[i] == e->epoca_atual ? e->usado[i] : 0;
+            k++;
         }
     }
+    ponto->estado = e->proximo_boost;
+}
 
-    // Anexa resumo final ao output principal
-    strcat(output_buffer, resumo_final);
- 
-    // Libera memória alocada dinamicamente
-    free(tempo_restante);
-    free(finalizado);
-    free(inicio_execucao);
+static void mlfq_restaurar(Motor *m, const PontoRetomada *ponto) {
+    EstadoMLFQ *e = m->politica;
+    for (int k = 0; k < ponto->n_prontos; k++) {
+        const ProntoRetomada *pr = &ponto->prontos[k];
+        e->usado[pr->indice] = (int)pr->valor;
+        e->epoca[pr->indice] = e->epoca_atual;
+        nivel_inserir(&e->filas[pr->nivel], e->proximo, pr->indice);
+        e->ocupados |= 1u << pr->nivel;
+        e->n_prontos++;
+    }
+    e->proximo_boost = ponto->estado;
+}
+
+static const Politica politica_mlfq = {
+    .preemptiva = 1,
+    .chegou = mlfq_chegou,
+    .tamanho = mlfq_tamanho,
+    .escolher = mlfq_escolher,
+    .fatia = mlfq_fatia,
+    .executou = mlfq_executou,
+    .devolver = mlfq_devolver,
+    .tempo_avancou = mlfq_tempo_avancou,
+    .crescer = mlfq_crescer,
+    .salvar = mlfq_salvar,
+    .restaurar = mlfq_restaurar,
+};
+
+SEMPRE_INLINE void executar_mlfq(Motor *m, const int *ordem, const ModoMotor modo, const ConfigMLFQ *config) {
+    EstadoMLFQ estado;
+    int tamanho = m->n > 0 ? m->n : 1;
+
+    estado.n_niveis = config->n_niveis;
+    if (estado.n_niveis < 1) {
+        estado.n_niveis = 1;
+    } else if (estado.n_niveis > MAX_NIVEIS_MLFQ) {
+        estado.n_niveis = MAX_NIVEIS_MLFQ;
+    }
+    for (int l = 0; l < estado.n_niveis; l++) {
+        estado.quanta[l] = config->quanta[l] < 1 ? 1 : config->quanta[l];
+        estado.filas[l].primeiro = estado.filas[l].ultimo = -1;
+    }
+    estado.ocupados = 0;
+    estado.n_prontos = 0;
+    estado.proximo = malloc(tamanho * sizeof(int));
+    estado.usado = malloc(tamanho * sizeof(int));
+    estado.epoca = malloc(tamanho * sizeof(int));
+    estado.epoca_atual = 0;
+    estado.periodo = config->periodo_boost > 0 ? config->periodo_boost : 0;
+    estado.proximo_boost = estado.periodo;
+    estado.nivel = 0;
+
+    m->res->quantum = estado.quanta[0];
+    m->politica = &estado;
+    executar_motor(&politica_mlfq, m, ordem, modo);
+
+    free(estado.proximo);
+    free(estado.usado);
+    free(estado.epoca);
+}
+
+// Simula o MLFQ com filas encadeadas por nível e mapa de bits dos níveis ocupados
+void simular_mlfq(const Processo *lista_processos, int n, const int *ordem_chegada,
+                  const ConfigMLFQ *config, ResultadoSimulacao *res) {
+    int *ordem_alocada;                         // Ordem montada aqui quando o chamador não fornece uma
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada); // Índices em ordem de chegada
+    Motor m;
+
+    resultado_preparar(res, ALGORITMO_MLFQ, lista_processos, n);
+    motor_inicializar(&m, &politica_mlfq, lista_processos, n, res);
+    executar_mlfq(&m, ordem, MOTOR_LISTA, config);
+
+    motor_finalizar(&m);
+    free(ordem_alocada);
+}
+
+void cfs_config_padrao(ConfigCFS *config) {
+    config->latencia_alvo = 24;
+    config->granularidade_minima = 3;
+}
+
+// Peso de cada valor nice de -20 a 19 (tabela sched_prio_to_weight do Linux)
+static const int pesos_nice[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15,
+};
+
+// Peso do nice 0; o tempo virtual anda na velocidade do relógio para esse peso
+#define PESO_NICE_0 1024
+
+// Bits extras de precisão do tempo virtual (evita que pesos altos arredondem para 0)
+#define ESCALA_VRUNTIME 10
+
+static int peso_cfs(int prioridade) {
+    if (prioridade < -20) prioridade = -20;
+    if (prioridade > 19) prioridade = 19;
+    return pesos_nice[prioridade + 20];
+}
+
+// CFS: prontos em uma árvore rubro-negra ordenada por (tempo virtual, PID)
+typedef struct {
+    ArvoreRN prontos;
+    int *peso;                                  // Peso de cada processo (pelo nice)
+    long long *vruntime;                        // Tempo virtual de cada processo
+    long long peso_total;                       // Soma dos pesos dos processos prontos e do atual
+    long long min_vruntime;                     // Menor tempo virtual da fila; nunca diminui
+    int latencia;
+    int granularidade;
+    int max_prontos;                            // Acima disto, a latência daria fatias menores que a granularidade
+} EstadoCFS;
+
+// Quem chega entra com o menor tempo virtual da fila, sem vantagem acumulada
+static void cfs_chegou(Motor *m, int j) {
+    EstadoCFS *e = m->politica;
+    e->peso[j] = peso_cfs(m->processos[j].prioridade);
+    e->vruntime[j] = e->min_vruntime;
+    e->peso_total += e->peso[j];
+    arvore_inserir(&e->prontos, j, e->vruntime[j], m->processos[j].pid);
+}
+
+static int cfs_tamanho(const Motor *m) {
+    return ((const EstadoCFS*)m->politica)->prontos.tamanho;
+}
+
+// Menor tempo virtual
+static int cfs_escolher(Motor *m) {
+    return arvore_remover_min(&((EstadoCFS*)m->politica)->prontos);
+}
+
+// Fatia proporcional ao peso dentro do período de escalonamento
+static int cfs_fatia(Motor *m, int i, int tempo, int proxima_chegada) {
+    const EstadoCFS *e = m->politica;
+    (void)tempo;
+    (void)proxima_chegada;
+    int n_prontos = e->prontos.tamanho + 1;
+    long long periodo = n_prontos > e->max_prontos ? (long long)n_prontos * e->granularidade : e->latencia;
+    long long fatia = periodo * e->peso[i] / e->peso_total;
+    if (fatia < e->granularidade) {
+        fatia = e->granularidade;
+    }
+    return fatia < INT_MAX ? (int)fatia : INT_MAX;
+}
+
+// Acumula o tempo virtual e avança o menor tempo virtual (o do processo atual ou o do primeiro da fila)
+static void cfs_executou(Motor *m, int i, int executado) {
+    EstadoCFS *e = m->politica;
+    e->vruntime[i] += ((long long)executado << ESCALA_VRUNTIME) * PESO_NICE_0 / e->peso[i];
+
+    long long menor = e->vruntime[i];
+    if (e->prontos.tamanho > 0 && e->prontos.nos[arvore_minimo(&e->prontos)].chave < menor) {
+        menor = e->prontos.nos[arvore_minimo(&e->prontos)].chave;
+    }
+    if (menor > e->min_vruntime) {
+        e->min_vruntime = menor;
+    }
+}
+
+static void cfs_devolver(Motor *m, int i) {
+    EstadoCFS *e = m->politica;
+    arvore_inserir(&e->prontos, i, e->vruntime[i], m->processos[i].pid);
+}
+
+static void cfs_concluiu(Motor *m, int i) {
+    EstadoCFS *e = m->politica;
+    e->peso_total -= e->peso[i];
+}
+
+static void cfs_crescer(Motor *m, int anterior) {
+    EstadoCFS *e = m->politica;
+    (void)anterior;
+    e->peso = realloc(e->peso, m->n * sizeof(int));
+    e->vruntime = realloc(e->vruntime, m->n * sizeof(long long));
+    if (e->peso == NULL || e->vruntime == NULL) {
+        abort();
+    }
+    arvore_crescer(&e->prontos, m->n);
 }
 
+static void cfs_salvar(const Motor *m, PontoRetomada *ponto) {
+    const EstadoCFS *e = m->politica;
+    int k = 0;
+    for (int i = e->prontos.minimo; i != e->prontos.capacidade; i = arvore_seguinte(&e->prontos, i)) {
+        ponto->prontos[k].indice = i;
+        ponto->prontos[k].valor = e->vruntime[i];
+        k++;
+    }
+    ponto->estado = e->min_vruntime;
+}
+
+// Com a CPU livre, a soma dos pesos é a dos prontos
+static void cfs_restaurar(Motor *m, const PontoRetomada *ponto) {
+    EstadoCFS *e = m->politica;
+    for (int k = 0; k < ponto->n_prontos; k++) {
+        int i = ponto->prontos[k].indice;
+        e->peso[i] = peso_cfs(m->processos[i].prioridade);
+        e->vruntime[i] = ponto->prontos[k].valor;
+        e->peso_total += e->peso[i];
+        arvore_inserir(&e->prontos, i, e->vruntime[i], m->processos[i].pid);
+    }
+    e->min_vruntime = ponto->estado;
+}
+
+static const Politica politica_cfs = {
+    .preemptiva = 1,
+    .chegou = cfs_chegou,
+    .tamanho = cfs_tamanho,
+    .escolher = cfs_escolher,
+    .fatia = cfs_fatia,
+    .executou = cfs_executou,
+    .devolver = cfs_devolver,
+    .concluiu = cfs_concluiu,
+    .crescer = cfs_crescer,
+    .salvar = cfs_salvar,
+    .restaurar = cfs_restaurar,
+};
+
+SEMPRE_INLINE void executar_cfs(Motor *m, const int *ordem, const ModoMotor modo, const ConfigCFS *config) {
+    EstadoCFS estado;
+    estado.latencia = config->latencia_alvo;
+    estado.granularidade = config->granularidade_minima;
+    if (estado.granularidade < 1) {
+        estado.granularidade = 1;
+    }
+    if (estado.latencia < estado.granularidade) {
+        estado.latencia = estado.granularidade;
+    }
+    estado.max_prontos = estado.latencia / estado.granularidade;
+
+    int tamanho = m->n > 0 ? m->n : 1;
+    estado.peso = malloc(tamanho * sizeof(int));
+    estado.vruntime = malloc(tamanho * sizeof(long long));
+    estado.peso_total = 0;
+    estado.min_vruntime = 0;
+
+    m->res->quantum = estado.latencia;
+    arvore_inicializar(&estado.prontos, m->n);
+    m->politica = &estado;
+    executar_motor(&politica_cfs, m, ordem, modo);
+
+    free(estado.peso);
+    free(estado.vruntime);
+    arvore_liberar(&estado.prontos);
+}
+
+// Simula o CFS com os prontos em uma árvore rubro-negra ordenada por tempo virtual
+void simular_cfs(const Processo *lista_processos, int n, const int *ordem_chegada,
+                 const ConfigCFS *config, ResultadoSimulacao *res) {
+    int *ordem_alocada;
+    const int *ordem = obter_ordem(lista_processos, n, ordem_chegada, &ordem_alocada);
+    Motor m;
+
+    resultado_preparar(res, ALGORITMO_CFS, lista_processos, n);
+    motor_inicializar(&m, &politica_cfs, lista_processos, n, res);
+    executar_cfs(&m, ordem, MOTOR_LISTA, config);
+
+    motor_finalizar(&m);
+    free(ordem_alocada);
+}
+
+// Nomes curtos dos algoritmos, na ordem do enum Algoritmo
+static const char *nomes_algoritmos[N_ALGORITMOS] = { "fifo", "sjf", "rr", "prioridade", "mlfq", "cfs", "srtf" };
+
+void parametros_padrao(ParametrosSimulacao *parametros, int quantum) {
+    parametros->quantum = quantum;
+    mlfq_config_padrao(&parametros->mlfq, quantum);
+    cfs_config_padrao(&parametros->cfs);
+}
+
+void simular_com_parametros(Algoritmo algoritmo, const Processo *lista_processos, int n, const int *ordem_chegada,
+                            const ParametrosSimulacao *parametros, ResultadoSimulacao *res) {
+    switch (algoritmo) {
+        case ALGORITMO_FIFO:
+            simular_FIFO(lista_processos, n, ordem_chegada, res);
+            break;
+        case ALGORITMO_SJF:
+            simular_sjf(lista_processos, n, ordem_chegada, res);
+            break;
+        case ALGORITMO_ROUND_ROBIN:
+            simular_round_robin(lista_processos, n, ordem_chegada, parametros->quantum, res);
+            break;
+        case ALGORITMO_PRIORIDADE:
+            simular_prioridade(lista_processos, n, ordem_chegada, res);
+            break;
+        case ALGORITMO_MLFQ:
+            simular_mlfq(lista_processos, n, ordem_chegada, &parametros->mlfq, res);
+            break;
+        case ALGORITMO_CFS:
+            simular_cfs(lista_processos, n, ordem_chegada, &parametros->cfs, res);
+            break;
+        case ALGORITMO_SRTF:
+            simular_srtf(lista_processos, n, ordem_chegada, res);
+            break;
+        default:
+            break;
+    }
+}
+
+// Políticas na ordem do enum Algoritmo
+static const Politica *politicas[N_ALGORITMOS] = {
+    &politica_fifo, &politica_sjf, &politica_rr, &politica_prioridade, &politica_mlfq, &politica_cfs, &politica_srtf,
+};
+
+int simular_em_fluxo(Algoritmo algoritmo, const ParametrosSimulacao *parametros, FonteProcessos *fonte,
+                     FuncaoConclusao concluiu, void *contexto, ResultadoSimulacao *res) {
+    Motor m;
+
+    resultado_preparar_fluxo(res, algoritmo);
+    if (algoritmo < 0 || algoritmo >= N_ALGORITMOS) {
+        return 1;
+    }
+    motor_inicializar_fluxo(&m, politicas[algoritmo], fonte, concluiu, contexto, res);
+    switch (algoritmo) {
+        case ALGORITMO_FIFO:
+            executar_fifo(&m, NULL, MOTOR_FLUXO);
+            break;
+        case ALGORITMO_SJF:
+            executar_sjf(&m, NULL, MOTOR_FLUXO);
+            break;
+        case ALGORITMO_ROUND_ROBIN:
+            executar_rr(&m, NULL, MOTOR_FLUXO, parametros->quantum);
+            break;
+        case ALGORITMO_PRIORIDADE:
+            executar_prioridade(&m, NULL, MOTOR_FLUXO);
+            break;
+        case ALGORITMO_MLFQ:
+            executar_mlfq(&m, NULL, MOTOR_FLUXO, &parametros->mlfq);
+            break;
+        case ALGORITMO_CFS:
+            executar_cfs(&m, NULL, MOTOR_FLUXO, &parametros->cfs);
+            break;
+        case ALGORITMO_SRTF:
+            executar_srtf(&m, NULL, MOTOR_FLUXO);
+            break;
+        default:
+            break;
+    }
+    motor_finalizar(&m);
+    return m.erro_fonte ? 0 : res->estouro_relogio ? -1 : 1;
+}
+
+int simular_com_retomada(Algoritmo algoritmo, const Processo *processos, int n,
+                         const ParametrosSimulacao *parametros, RetomadaSimulacao *retomada,
+                         int partida, ResultadoSimulacao *res) {
+    Motor m;
+
+    if (algoritmo < 0 || algoritmo >= N_ALGORITMOS) {
+        return 0;
+    }
+    int *ordem = malloc((n > 0 ? n : 1) * sizeof(int));   // Os processos já estão em ordem de chegada
+    if (ordem == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < n; i++) {
+        ordem[i] = i;
+    }
+
+    retomada_preparar(retomada, n, partida);
+    if (retomada->partida >= 0) {
+        retomada_restaurar_resultado(&retomada->pontos[retomada->partida], algoritmo, processos, n, res);
+    } else {
+        resultado_preparar(res, algoritmo, processos, n);
+    }
+    motor_inicializar(&m, politicas[algoritmo], processos, n, res);
+    m.retomada = retomada;
+    switch (algoritmo) {
+        case ALGORITMO_FIFO:
+            executar_fifo(&m, ordem, MOTOR_RETOMADA);
+            break;
+        case ALGORITMO_SJF:
+            executar_sjf(&m, ordem, MOTOR_RETOMADA);
+            break;
+        case ALGORITMO_ROUND_ROBIN:
+            executar_rr(&m, ordem, MOTOR_RETOMADA, parametros->quantum);
+            break;
+        case ALGORITMO_PRIORIDADE:
+            executar_prioridade(&m, ordem, MOTOR_RETOMADA);
+            break;
+        case ALGORITMO_MLFQ:
+            executar_mlfq(&m, ordem, MOTOR_RETOMADA, &parametros->mlfq);
+            break;
+        case ALGORITMO_CFS:
+            executar_cfs(&m, ordem, MOTOR_RETOMADA, &parametros->cfs);
+            break;
+        case ALGORITMO_SRTF:
+            executar_srtf(&m, ordem, MOTOR_RETOMADA);
+            break;
+        default:
+            break;
+    }
+    motor_finalizar(&m);
+    free(ordem);
+    return 1;
+}
+
+void simular_algoritmo(Algoritmo algoritmo, const Processo *lista_processos, int n, const int *ordem_chegada,
+                       int quantum, ResultadoSimulacao *res) {
+    ParametrosSimulacao parametros;
+    parametros_padrao(&parametros, quantum);
+    simular_com_parametros(algoritmo, lista_processos, n, ordem_chegada, &parametros, res);
+}
+
+const char* nome_algoritmo(Algoritmo algoritmo) {
+    if (algoritmo < 0 || algoritmo >= N_ALGORITMOS) {
+        return "?";
+    }
+    return nomes_algoritmos[algoritmo];
+}
+
+int algoritmo_por_nome(const char *nome, Algoritmo *algoritmo) {
+    for (int i = 0; i < N_ALGORITMOS; i++) {
+        if (strcmp(nome, nomes_algoritmos[i]) == 0) {
+            *algoritmo = (Algoritmo)i;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -10,24 +10,141 @@
 #define SIMULADOR_H           // Define SIMULADOR_H para garantir que este header só seja incluído uma vez
 
 #include "processos.h"        // Inclui a definição da struct Processo e outras dependências necessárias
+#include "resultado.h"        // Resultado estruturado (métricas e intervalos de execução)
 
 // Declara a função de simulação do algoritmo FIFO (First-Come, First-Served)
 // - lista_processos: vetor de processos a serem simulados
 // - n: quantidade de processos
-// - output_buffer: buffer de string onde o resultado formatado será armazenado
-void simular_FIFO(Processo *lista_processos, int n, char *output_buffer);
+// - ordem_chegada: índices em ordem de (chegada, PID), como em ordem_por_chegada;
+//   se for NULL, a ordem é montada internamente a cada chamada
+// - res: resultado inicializado com resultado_inicializar; é reaproveitado entre execuções
+//   e passa a conter as métricas de cada processo e os intervalos de execução;
+//   se res->controle não for NULL, o progresso é publicado nele periodicamente e a
+//   simulação para quando for pedido o cancelamento (res->cancelada passa a ser 1);
+//   se o relógio passaria de INT_MAX, a simulação também para (res->estouro_relogio passa a ser 1)
+void simular_FIFO(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res);
 
 // Declara a função de simulação do algoritmo SJF (Shortest Job First, não-preemptivo)
-// Mesmos parâmetros: vetor de processos, número de processos e buffer de saída
-void simular_sjf(Processo *lista_processos, int n, char *output_buffer);
+// Mesmos parâmetros: vetor de processos, número de processos, ordem de chegada e resultado
+void simular_sjf(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res);
 
-// Declara a função para simulação do algoritmo Round Robin (preemptivo com quantum fixo)
-// Executa os processos em fatias de tempo iguais 
-// Parâmetros seguem o mesmo padrão
-void simular_round_robin(Processo *lista_processos, int n, char *output_buffer);
+// Quantum usado pelo Round Robin quando o usuário não informa outro valor
+#define QUANTUM_PADRAO 2
+
+// Declara a função para simulação do algoritmo Round Robin (preemptivo com quantum configurável)
+// Executa os processos em fatias de tempo iguais, na ordem de uma fila circular de prontos
+// - quantum: tamanho da fatia de tempo de cada processo (valores < 1 são tratados como 1)
+// Demais parâmetros seguem o mesmo padrão
+void simular_round_robin(const Processo *lista_processos, int n, const int *ordem_chegada, int quantum, ResultadoSimulacao *res);
 
 // Declara a função para simulação do algoritmo de prioridade preemptiva
 // Executa o processo com maior prioridade (menor valor numérico) a cada ciclo
-void simular_prioridade(Processo *lista_processos, int n, char *output_buffer);
+void simular_prioridade(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res);
+
+// Declara a função para simulação do SRTF (Shortest Remaining Time First, SJF preemptivo)
+// Executa o processo com menor tempo restante; a preempção só é avaliada nas chegadas,
+// então cada decisão é O(log n) e trechos seguidos do mesmo processo viram um intervalo
+void simular_srtf(const Processo *lista_processos, int n, const int *ordem_chegada, ResultadoSimulacao *res);
+
+// Quantidade máxima de níveis do MLFQ (um bit por nível no mapa de filas ocupadas)
+#define MAX_NIVEIS_MLFQ 32
+
+// Parâmetros do MLFQ (Multi-Level Feedback Queue)
+typedef struct {
+    int n_niveis;                       // Quantidade de níveis (1 a MAX_NIVEIS_MLFQ); nível 0 é o mais prioritário
+    int quanta[MAX_NIVEIS_MLFQ];        // Quantum de cada nível (valores < 1 são tratados como 1)
+    int periodo_boost;                  // A cada quantas unidades de tempo todos voltam ao nível 0 (0 = nunca)
+} ConfigMLFQ;
+
+// Configuração padrão do MLFQ a partir de um quantum base:
+// 3 níveis com quanta q, 2q e 4q, e boost a cada 50q unidades de tempo
+void mlfq_config_padrao(ConfigMLFQ *config, int quantum);
+
+// Declara a função para simulação do MLFQ
+// Processos chegam no nível 0; quem esgota o quantum do nível desce um nível;
+// chegadas interrompem processos de níveis inferiores; a cada periodo_boost,
+// todos voltam ao nível 0. A escolha do próximo processo é O(1): cada nível é
+// uma fila circular e um mapa de bits indica os níveis não vazios
+void simular_mlfq(const Processo *lista_processos, int n, const int *ordem_chegada,
+                  const ConfigMLFQ *config, ResultadoSimulacao *res);
+
+// Parâmetros do CFS (Completely Fair Scheduler)
+typedef struct {
+    int latencia_alvo;                  // Período em que todo processo pronto deve executar uma vez
+    int granularidade_minima;           // Menor fatia concedida a um processo (valores < 1 são tratados como 1)
+} ConfigCFS;
+
+// Configuração padrão do CFS: latência alvo 24 e granularidade mínima 3 (a proporção 8:1 do Linux)
+void cfs_config_padrao(ConfigCFS *config);
+
+// Declara a função para simulação do CFS
+// O campo prioridade é usado como valor "nice" (limitado a -20..19) e convertido
+// no peso do processo pela tabela do Linux (nice 0 = peso 1024, cada nível ~1,25x).
+// Cada processo acumula tempo virtual = tempo executado * 1024 / peso; o próximo
+// a executar é o de menor tempo virtual, e a fatia é a parte proporcional ao peso
+// da latência alvo (estendida quando há processos demais para a granularidade
+// mínima). Os prontos ficam em uma árvore rubro-negra com o mínimo em cache:
+// escolher e reinserir um processo é O(log n)
+void simular_cfs(const Processo *lista_processos, int n, const int *ordem_chegada,
+                 const ConfigCFS *config, ResultadoSimulacao *res);
+
+// Parâmetros de todos os algoritmos, para escolher o algoritmo em tempo de execução
+typedef struct {
+    int quantum;                        // Quantum do Round Robin
+    ConfigMLFQ mlfq;                    // Níveis, quanta e boost do MLFQ
+    ConfigCFS cfs;                      // Latência alvo e granularidade do CFS
+} ParametrosSimulacao;
+
+// Preenche os parâmetros padrão de todos os algoritmos a partir do quantum
+void parametros_padrao(ParametrosSimulacao *parametros, int quantum);
+
+// Executa o algoritmo indicado com os parâmetros informados
+void simular_com_parametros(Algoritmo algoritmo, const Processo *lista_processos, int n, const int *ordem_chegada,
+                            const ParametrosSimulacao *parametros, ResultadoSimulacao *res);
+
+// Origem dos processos da simulação em fluxo, em ordem crescente de (chegada, PID)
+typedef struct {
+    // Preenche o próximo processo; retorna 1 se leu, 0 no fim e -1 em erro
+    int (*proximo)(void *contexto, Processo *p);
+    void *contexto;
+} FonteProcessos;
+
+// Recebe as métricas de um processo assim que ele termina (o ponteiro só vale durante a chamada)
+typedef void (*FuncaoConclusao)(void *contexto, const MetricaProcesso *metrica);
+
+// Executa o algoritmo indicado lendo os processos da fonte à medida que chegam,
+// em uma CPU. Só os processos que já chegaram e não terminaram ficam na memória,
+// cada um em uma vaga que é reaproveitada quando ele termina: a memória é
+// proporcional ao máximo de processos simultâneos, não ao total. As métricas de
+// cada processo vão para `concluiu` (pode ser NULL) e o resultado fica apenas
+// com as estatísticas agregadas (ver resultado_preparar_fluxo); com res->rastro,
+// os intervalos seguem para o rastro
+// Retorna 1 se a simulação foi até o fim, 0 se a fonte falhar e -1 se o relógio
+// passaria de INT_MAX; nos dois últimos casos ela para ali e o resultado não vale
+int simular_em_fluxo(Algoritmo algoritmo, const ParametrosSimulacao *parametros, FonteProcessos *fonte,
+                     FuncaoConclusao concluiu, void *contexto, ResultadoSimulacao *res);
+
+struct RetomadaSimulacao;      // Pontos de retomada (ver retomada.h)
+
+// Executa o algoritmo indicado em uma CPU, como simular_com_parametros, guardando
+// pontos de retomada em `retomada`; os processos devem estar em ordem de chegada.
+// Com partida >= 0 (ver retomada_escolher), `res` e `retomada` devem vir da simulação
+// anterior com o mesmo algoritmo e parâmetros, e a simulação continua daquele ponto
+// com o mesmo resultado que teria do início. Retorna 0 se faltar memória
+int simular_com_retomada(Algoritmo algoritmo, const Processo *processos, int n,
+                         const ParametrosSimulacao *parametros, struct RetomadaSimulacao *retomada,
+                         int partida, ResultadoSimulacao *res);
+
+// Executa o algoritmo indicado sobre a lista de processos
+// - quantum: usado pelo Round Robin e, com mlfq_config_padrao, pelo MLFQ
+// Os demais parâmetros são os de parametros_padrao
+void simular_algoritmo(Algoritmo algoritmo, const Processo *lista_processos, int n, const int *ordem_chegada,
+                       int quantum, ResultadoSimulacao *res);
+
+// Retorna o nome curto do algoritmo ("fifo", "sjf", "rr", "prioridade", "mlfq", "cfs", "srtf")
+const char* nome_algoritmo(Algoritmo algoritmo);
+
+// Converte um nome curto em algoritmo; retorna 0 se o nome for desconhecido
+int algoritmo_por_nome(const char *nome, Algoritmo *algoritmo);
 
 #endif  // Finaliza a diretiva de inclusão condicional
@@ -0,0 +1,204 @@
+/**
+ * @file varredura.c
+ * @brief Implementação da varredura de parâmetros em paralelo.
+ *
+ * A tarefa t é a combinação t % n_configuracoes na amostra t / n_configuracoes:
+ * tarefas vizinhas usam a mesma carga, então cada thread só gera uma carga
+ * nova quando muda de amostra. Cada thread tem seu próprio resultado e seus
+ * próprios vetores; as métricas de cada tarefa vão para uma posição própria
+ * e são agregadas no fim, na mesma ordem qualquer que seja a thread.
+ */
+
+#include <stdlib.h>     // malloc, calloc, free
+#include <math.h>       // sqrt
+#include <limits.h>     // INT_MAX
+#include "varredura.h"
+#include "paralelo.h"
+#include "resultado.h"
+
+// Métricas extraídas de uma simulação, na ordem dos campos de ResumoVarredura
+enum {
+    M_TURNAROUND,
+    M_ESPERA,
+    M_RESPOSTA,
+    M_P99_TURNAROUND,
+    M_VAZAO,
+    M_UTILIZACAO,
+    M_TROCAS,
+    N_METRICAS
+};
+
+// Memória de uma thread
+typedef struct {
+    Processo *processos;                // Carga gerada (NULL com carga fixa)
+    int *ordem;                         // Ordem identidade da carga gerada
+    int amostra_gerada;                 // Amostra que está em `processos` (-1 = nenhuma)
+    int estouro;                        // Alguma carga gerada ou simulação passou de INT_MAX
+    ResultadoSimulacao res;
+} MemoriaThread;
+
+// Dados compartilhados (somente leitura, exceto a posição de cada tarefa em `metricas`)
+typedef struct {
+    const CargaVarredura *carga;
+    const ConfiguracaoVarredura *configuracoes;
+    int n_configuracoes;
+    MemoriaThread *memorias;
+    double *metricas;                   // N_METRICAS valores por tarefa
+} ContextoVarredura;
+
+// Valor crítico t de Student (bicaudal, 95%) para `graus` graus de liberdade
+static double t_critico_95(int graus) {
+    static const double tabela[30] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+         2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+         2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+    };
+    return graus <= 30 ? tabela[graus - 1] : 1.960;
+}
+
+static void executar_tarefa_varredura(void *contexto, int tarefa, int trabalhador) {
+    ContextoVarredura *v = contexto;
+    const CargaVarredura *carga = v->carga;
+    MemoriaThread *m = &v->memorias[trabalhador];
+    int amostra = tarefa / v->n_configuracoes;
+    const ConfiguracaoVarredura *cfg = &v->configuracoes[tarefa % v->n_configuracoes];
+    unsigned long long semente = carga->semente + (unsigned long long)amostra;
+
+    const Processo *processos = carga->processos;
+    const int *ordem = carga->ordem;
+    if (processos == NULL) {
+        if (m->amostra_gerada != amostra) {
+            if (!gerar_carga(carga->tipo, carga->n, semente, m->processos)) {
+                m->estouro = 1;
+                m->amostra_gerada = -1;
+                return;
+            }
+            m->amostra_gerada = amostra;
+        }
+        processos = m->processos;
+        ordem = m->ordem;
+    }
+
+    if (cfg->cpus.n_cpus > 1 && multicpu_suporta(cfg->algoritmo)) {
+        ConfigMultiCPU cpus = cfg->cpus;
+        cpus.semente = (unsigned)(cfg->cpus.semente + (unsigned long long)amostra);
+        simular_multicpu(cfg->algoritmo, processos, carga->n, ordem, cfg->parametros.quantum, &cpus, &m->res);
+    } else {
+        simular_com_parametros(cfg->algoritmo, processos, carga->n, ordem, &cfg->parametros, &m->res);
+    }
+
+    const ResultadoSimulacao *res = &m->res;
+    if (res->estouro_relogio) {
+        m->estouro = 1;
+        return;
+    }
+    long long ocupado = 0;
+    for (int c = 0; c < res->n_cpus; c++) {
+        ocupado += res->ocupado_cpu[c];
+    }
+    double duracao = res->instante_final;
+    double *saida = &v->metricas[(size_t)tarefa * N_METRICAS];
+    saida[M_TURNAROUND] = histograma_media(&res->hist_turnaround);
+    saida[M_ESPERA] = histograma_media(&res->hist_espera);
+    saida[M_RESPOSTA] = histograma_media(&res->hist_resposta);
+    saida[M_P99_TURNAROUND] = histograma_percentil(&res->hist_turnaround, 99);
+    saida[M_VAZAO] = duracao > 0 ? res->n_concluidos / duracao : 0.0;
+    saida[M_UTILIZACAO] = duracao > 0 ? ocupado / (duracao * res->n_cpus) : 0.0;
+    saida[M_TROCAS] = (double)res->n_trocas_contexto;
+}
+
+// Média e intervalo de confiança de uma métrica de uma combinação em todas as amostras
+static Estimativa estimar(const double *metricas, int configuracao, int n_configuracoes,
+                          int amostras, int metrica) {
+    Estimativa e = { 0.0, 0.0 };
+    double soma = 0.0;
+    for (int k = 0; k < amostras; k++) {
+        soma += metricas[((size_t)k * n_configuracoes + configuracao) * N_METRICAS + metrica];
+    }
+    e.media = soma / amostras;
+    if (amostras > 1) {
+        double quadrados = 0.0;
+        for (int k = 0; k < amostras; k++) {
+            double d = metricas[((size_t)k * n_configuracoes + configuracao) * N_METRICAS + metrica] - e.media;
+            quadrados += d * d;
+        }
+        double desvio = sqrt(quadrados / (amostras - 1));
+        e.ic95 = t_critico_95(amostras - 1) * desvio / sqrt((double)amostras);
+    }
+    return e;
+}
+
+int executar_varredura(const CargaVarredura *carga, const ConfiguracaoVarredura *configuracoes,
+                       int n_configuracoes, int n_threads, ResumoVarredura *resumos) {
+    int amostras = carga->amostras > 0 ? carga->amostras : 1;
+    if ((long long)amostras * n_configuracoes > INT_MAX) {
+        return 0;                       // Tarefas demais para indexar (e para a memória das métricas)
+    }
+    int n_tarefas = amostras * n_configuracoes;
+    if (n_threads <= 0) {
+        n_threads = numero_de_nucleos();
+    }
+    if (n_threads > n_tarefas) {
+        n_threads = n_tarefas > 0 ? n_tarefas : 1;
+    }
+
+    ContextoVarredura v;
+    v.carga = carga;
+    v.configuracoes = configuracoes;
+    v.n_configuracoes = n_configuracoes;
+    v.metricas = malloc((size_t)(n_tarefas > 0 ? n_tarefas : 1) * N_METRICAS * sizeof(double));
+    v.memorias = calloc(n_threads, sizeof(MemoriaThread));
+    int ok = v.metricas != NULL && v.memorias != NULL;
+
+    for (int w = 0; ok && w < n_threads; w++) {
+        MemoriaThread *m = &v.memorias[w];
+        resultado_inicializar(&m->res);
+        m->amostra_gerada = -1;
+        if (carga->processos == NULL) {
+            int tamanho = carga->n > 0 ? carga->n : 1;
+            m->processos = malloc(tamanho * sizeof(Processo));
+            m->ordem = malloc(tamanho * sizeof(int));
+            if (m->processos == NULL || m->ordem == NULL) {
+                ok = 0;
+                break;
+            }
+            for (int i = 0; i < carga->n; i++) {
+                m->ordem[i] = i;        // Cargas geradas já saem em ordem de chegada
+            }
+        }
+    }
+
+    if (ok) {
+        ok = executar_em_paralelo(n_tarefas, n_threads, executar_tarefa_varredura, &v);
+    }
+    for (int w = 0; ok == 1 && w < n_threads; w++) {
+        if (v.memorias[w].estouro) {
+            ok = -1;
+        }
+    }
+
+    if (ok == 1) {
+        for (int c = 0; c < n_configuracoes; c++) {
+            ResumoVarredura *r = &resumos[c];
+            r->amostras = amostras;
+            r->turnaround = estimar(v.metricas, c, n_configuracoes, amostras, M_TURNAROUND);
+            r->espera = estimar(v.metricas, c, n_configuracoes, amostras, M_ESPERA);
+            r->resposta = estimar(v.metricas, c, n_configuracoes, amostras, M_RESPOSTA);
+            r->p99_turnaround = estimar(v.metricas, c, n_configuracoes, amostras, M_P99_TURNAROUND);
+            r->vazao = estimar(v.metricas, c, n_configuracoes, amostras, M_VAZAO);
+            r->utilizacao = estimar(v.metricas, c, n_configuracoes, amostras, M_UTILIZACAO);
+            r->trocas_contexto = estimar(v.metricas, c, n_configuracoes, amostras, M_TROCAS);
+        }
+    }
+
+    if (v.memorias != NULL) {
+        for (int w = 0; w < n_threads; w++) {
+            resultado_liberar(&v.memorias[w].res);
+            free(v.memorias[w].processos);
+            free(v.memorias[w].ordem);
+        }
+    }
+    free(v.memorias);
+    free(v.metricas);
+    return ok;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file varredura.h
+ * @brief Varredura de parâmetros e Monte Carlo em paralelo.
+ *
+ * Executa cada combinação de algoritmo e parâmetros sobre várias amostras
+ * (cargas geradas com sementes consecutivas, ou a mesma carga com sementes
+ * de sorteio de CPU diferentes) em todas as threads disponíveis, e resume as
+ * métricas de cada combinação com média e intervalo de confiança de 95%.
+ * As simulações só leem a carga, então as amostras são independentes entre si.
+ */
+
+#ifndef VARREDURA_H           // Evita inclusão duplicada
+#define VARREDURA_H
+
+#include "processos.h"        // Definição da struct Processo
+#include "simulador.h"        // ParametrosSimulacao
+#include "multicpu.h"         // ConfigMultiCPU
+#include "gerador.h"          // Tipos de carga sintética
+
+// Uma combinação de algoritmo e parâmetros
+typedef struct {
+    Algoritmo algoritmo;
+    ParametrosSimulacao parametros;     // Quantum, MLFQ e CFS
+    ConfigMultiCPU cpus;                // Com n_cpus > 1, usa simular_multicpu quando o algoritmo permitir
+} ConfiguracaoVarredura;
+
+// Carga simulada em cada amostra
+typedef struct {
+    const Processo *processos;          // Carga fixa; NULL = gerar uma carga por amostra
+    const int *ordem;                   // Ordem de chegada da carga fixa (como em ordem_por_chegada)
+    int n;                              // Quantidade de processos (da carga fixa ou de cada carga gerada)
+    TipoCarga tipo;                     // Tipo de carga gerada (quando processos == NULL)
+    unsigned long long semente;         // A amostra k usa semente + k (no gerador e no sorteio de CPUs)
+    int amostras;                       // Quantidade de amostras por combinação
+} CargaVarredura;
+
+// Média das amostras e metade da largura do intervalo de confiança de 95% (t de Student)
+typedef struct {
+    double media;
+    double ic95;                        // 0 com uma única amostra
+} Estimativa;
+
+// Resumo de uma combinação
+typedef struct {
+    int amostras;
+    Estimativa turnaround;              // Turnaround médio de cada amostra
+    Estimativa espera;                  // Espera média
+    Estimativa resposta;                // Tempo de resposta médio
+    Estimativa p99_turnaround;          // Percentil 99 do turnaround
+    Estimativa vazao;                   // Processos concluídos por unidade de tempo
+    Estimativa utilizacao;              // Fração do tempo com as CPUs ocupadas (0 a 1)
+    Estimativa trocas_contexto;         // Trocas de contexto
+} ResumoVarredura;
+
+// Executa todas as combinações × amostras em n_threads threads (<= 0: uma por núcleo)
+// e preenche resumos[c] para cada configuracoes[c]. O resultado não depende da
+// quantidade de threads. Retorna 1 se tudo correu bem, 0 se faltar memória (ou se
+// amostras × combinações passar de INT_MAX) e
+// -1 se alguma carga gerada tiver chegadas acima de INT_MAX (ver gerar_carga) ou
+// alguma simulação parar por estouro do relógio
+int executar_varredura(const CargaVarredura *carga, const ConfiguracaoVarredura *configuracoes,
+                       int n_configuracoes, int n_threads, ResumoVarredura *resumos);
+
+#endif